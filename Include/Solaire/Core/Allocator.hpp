@@ -34,6 +34,7 @@
 #include "AllocatorI.hpp"
 #include "UniqueAllocation.hpp"
 #include "SharedAllocation.hpp"
+#include "IntrusiveShared.hpp"
 
 namespace Solaire {
 
@@ -69,6 +70,25 @@ namespace Solaire {
 			return new(allocate(sizeof(T))) T(aParams...);
 		}
 
+		/*!
+			\brief Allocate \a aCount separate blocks that will each fit type \a T
+			\detail The blocks are allocated with a single call to AllocateBatch, each one can be deallocated individually.
+			\tparam T The type to allocate.
+			\tparam PARAMS The parameter types to pass to each object's constructor.
+			\param aCount The number of objects to allocate.
+			\param aOut The array that the addresses of the objects will be written to.
+			\param aParams The parameters to pass to each object's constructor.
+			\return True if all of the objects were allocated, otherwise no objects are allocated.
+			\see AllocateBatch
+		*/
+		template<class T, typename ...PARAMS>
+		inline bool SOLAIRE_DEFAULT_CALL rawAllocateN(const uint32_t aCount, T** const aOut, PARAMS&&... aParams) {
+			void** const blocks = reinterpret_cast<void**>(aOut);
+			if(! allocateBatch(sizeof(T), aCount, blocks)) return false;
+			for(uint32_t i = 0; i < aCount; ++i) aOut[i] = new(blocks[i]) T(aParams...);
+			return true;
+		}
+
 		/*!
 			\brief Allocated a block of memory that will fit type \a T
 			\detail Allocation size is determined uisng sizeof
@@ -88,7 +108,7 @@ namespace Solaire {
 
 		/*!
 			\brief Allocated a block of memory that will fit type \a T
-			\detail Allocation size is determined uisng sizeof
+			\detail The object and its SharedObject are created with a single allocation.
 			\tparam T The type to allocate.
 			\tparam PARAMS The parameter types to pass to the object's constructor.
 			\param aParams The parameters to pass to the object's constructor.
@@ -97,10 +117,21 @@ namespace Solaire {
 		*/
 		template<class T, typename ...PARAMS>
 		SOLAIRE_FORCE_INLINE SharedAllocation<T> SOLAIRE_DEFAULT_CALL sharedAllocate(PARAMS&&... aParams) {
-			return SharedAllocation<T>(
-				*this,
-				new(allocate(sizeof(T))) T(aParams...)
-			);
+			return makeShared<T>(*this, aParams...);
+		}
+
+		/*!
+			\brief Allocate an object that derives from RefCounted.
+			\detail This Allocator is passed to the object's constructor before \a aParams.
+			\tparam T The type to allocate.
+			\tparam PARAMS The parameter types to pass to the object's constructor.
+			\param aParams The parameters to pass to the object's constructor.
+			\return The address of the object, or nullptr if the allocation failed.
+			\see makeIntrusive
+		*/
+		template<class T, typename ...PARAMS>
+		SOLAIRE_FORCE_INLINE IntrusiveShared<T> SOLAIRE_DEFAULT_CALL intrusiveAllocate(PARAMS&&... aParams) {
+			return makeIntrusive<T>(*this, aParams...);
 		}
     };
 
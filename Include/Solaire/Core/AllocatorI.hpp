@@ -28,10 +28,12 @@
 	\version 1.0
 	\date
 	Created			: 25th September 2015
-	Last Modified	: 4th January 2015
+	Last Modified	: 17th October 2026
 */
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include "ModuleHeader.hpp"
 
 namespace Solaire {
@@ -46,6 +48,10 @@ namespace Solaire {
 		\version 1.0
 	*/
 	SOLAIRE_EXPORT_INTERFACE AllocatorI {
+    public:
+		enum : uint32_t {
+			DEFAULT_ALIGNMENT = alignof(std::max_align_t)
+		};
     public:
 		/*!
 			\brief Return the total number of bytes that are currently allocated by this Allocator.
@@ -70,6 +76,7 @@ namespace Solaire {
 
 		/*!
 			\brief Allocate a block of memory.
+			\detail Like operator new, a request for 0 bytes returns a unique block that must still be deallocated.
 			\param aBytes The number of bytes to allocate.
 			\return The starting address of the allocated block, or nullptr if the allocation failed.
 			\see Deallocate
@@ -91,6 +98,86 @@ namespace Solaire {
 		*/
 		virtual SOLAIRE_DEFAULT_API bool SOLAIRE_EXPORT_CALL deallocateAll() throw() = 0;
 
+		/*!
+			\brief Allocate a block of memory with a specific alignment.
+			\detail The block is released with deallocate like any other block.
+			The default implementation can only satisfy alignments up to DEFAULT_ALIGNMENT.
+			\param aBytes The number of bytes to allocate.
+			\param aAlignment The alignment of the block in bytes, this must be a power of 2.
+			\return The starting address of the allocated block, or nullptr if the allocation failed.
+			\see Allocate
+		*/
+		virtual SOLAIRE_DEFAULT_API void* SOLAIRE_EXPORT_CALL allocateAligned(const size_t aBytes, const size_t aAlignment) throw() {
+			if(aAlignment > DEFAULT_ALIGNMENT) return nullptr;
+			return allocate(aBytes);
+		}
+
+		/*!
+			\brief Deallocate a block of memory when the size of the block is already known.
+			\detail Allocators can use \a aBytes to skip looking up the size of the block.
+			\param aObject The starting address of the block to deallocate.
+			\param aBytes The size that was requested when the block was allocated.
+			\return True if the block was deallocated successfully.
+			\see Deallocate
+		*/
+		virtual SOLAIRE_DEFAULT_API bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject, const size_t /*aBytes*/) throw() {
+			return deallocate(aObject);
+		}
+
+		/*!
+			\brief Change the size of an allocated block.
+			\detail The block is grown or shrunk in place when possible, otherwise the contents are copied to a new block.
+			If \a aObject is nullptr this behaves like allocate.
+			\param aObject The starting address of the block to resize.
+			\param aBytes The new size of the block in bytes.
+			\return The starting address of the resized block, or nullptr if the allocation failed, in which case \a aObject is left untouched.
+			\see Allocate
+		*/
+		virtual SOLAIRE_DEFAULT_API void* SOLAIRE_EXPORT_CALL reallocate(const void* const aObject, const size_t aBytes) throw() {
+			if(aObject == nullptr) return allocate(aBytes);
+			const size_t oldBytes = sizeOf(aObject);
+			void* const tmp = allocate(aBytes);
+			if(tmp == nullptr) return nullptr;
+			std::memcpy(tmp, aObject, oldBytes < aBytes ? oldBytes : aBytes);
+			deallocate(aObject);
+			return tmp;
+		}
+
+		/*!
+			\brief Allocate several blocks of the same size.
+			\detail Either every block is allocated or none are.
+			\param aBytes The number of bytes in each block.
+			\param aCount The number of blocks to allocate.
+			\param aOut The array that the addresses of the blocks will be written to, it must have room for \a aCount pointers.
+			\return True if all of the blocks were allocated.
+			\see DeallocateBatch
+		*/
+		virtual SOLAIRE_DEFAULT_API bool SOLAIRE_EXPORT_CALL allocateBatch(const size_t aBytes, const uint32_t aCount, void** const aOut) throw() {
+			for(uint32_t i = 0; i < aCount; ++i) {
+				aOut[i] = allocate(aBytes);
+				if(aOut[i] == nullptr) {
+					deallocateBatch(aOut, i);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/*!
+			\brief Deallocate several blocks of memory.
+			\param aObjects The starting addresses of the blocks to deallocate.
+			\param aCount The number of blocks in \a aObjects.
+			\return True if every block was deallocated successfully.
+			\see AllocateBatch
+		*/
+		virtual SOLAIRE_DEFAULT_API bool SOLAIRE_EXPORT_CALL deallocateBatch(void* const* const aObjects, const uint32_t aCount) throw() {
+			bool result = true;
+			for(uint32_t i = 0; i < aCount; ++i) {
+				if(! deallocate(aObjects[i])) result = false;
+			}
+			return result;
+		}
+
 		/*!
 			\brief Destroy the Allocator.
 			\detail DeallocateAll will be called before the Allocator is destroyed.
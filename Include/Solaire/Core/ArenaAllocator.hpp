@@ -0,0 +1,271 @@
+#ifndef SOLAIRE_ARENA_ALLOCATOR_HPP
+#define SOLAIRE_ARENA_ALLOCATOR_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ArenaAllocator.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include "Solaire/Core/Allocator.hpp"
+
+namespace Solaire{
+
+	/*!
+		\class ArenaAllocator
+		\brief An Allocator that hands out memory by bumping a pointer through large chunks.
+		\detail Individual deallocations only release memory when they are the most recent allocation,
+		everything else is reclaimed by deallocateAll, which rewinds to the first chunk without returning
+		the chunks to the system. Allocations larger than a chunk are given a dedicated block.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+	*/
+	class ArenaAllocator : public Allocator {
+	public:
+		enum : uint32_t {
+			DEFAULT_CHUNK_SIZE = 64 * 1024,
+			ALIGNMENT = alignof(std::max_align_t),
+			HEADER_SIZE = sizeof(uint32_t)
+		};
+	private:
+		struct Chunk {
+			Chunk* next;
+			uint32_t size;
+
+			SOLAIRE_FORCE_INLINE uintptr_t begin() const throw() {
+				return reinterpret_cast<uintptr_t>(this + 1);
+			}
+
+			SOLAIRE_FORCE_INLINE uintptr_t end() const throw() {
+				return begin() + size;
+			}
+		};
+	private:
+		Chunk* mChunks;
+		Chunk* mCurrent;
+		Chunk* mLargeChunks;
+		uintptr_t mTop;
+		uintptr_t mEnd;
+		const uint32_t mChunkSize;
+		uint32_t mChunkCount;
+		uint32_t mChunkIndex;
+		uint32_t mAllocatedBytes;
+	private:
+		ArenaAllocator(const ArenaAllocator&) = delete;
+		ArenaAllocator(ArenaAllocator&&) = delete;
+		ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+		ArenaAllocator& operator=(ArenaAllocator&&) = delete;
+
+		static SOLAIRE_FORCE_INLINE uintptr_t alignBlock(const uintptr_t aAddress, const size_t aAlignment = ALIGNMENT) throw() {
+			return (aAddress + HEADER_SIZE + (aAlignment - 1)) & ~static_cast<uintptr_t>(aAlignment - 1);
+		}
+
+		static Chunk* createChunk(const uint32_t aSize) throw() {
+			Chunk* const chunk = static_cast<Chunk*>(operator new(sizeof(Chunk) + aSize, std::nothrow));
+			if(chunk == nullptr) return nullptr;
+			chunk->next = nullptr;
+			chunk->size = aSize;
+			return chunk;
+		}
+
+		static void destroyChunks(Chunk* aChunk) throw() {
+			while(aChunk != nullptr) {
+				Chunk* const next = aChunk->next;
+				operator delete(aChunk);
+				aChunk = next;
+			}
+		}
+
+		bool nextChunk() throw() {
+			Chunk* const next = mCurrent == nullptr ? mChunks : mCurrent->next;
+			if(next != nullptr) {
+				mCurrent = next;
+			}else {
+				Chunk* const chunk = createChunk(mChunkSize);
+				if(chunk == nullptr) return false;
+				if(mCurrent == nullptr) mChunks = chunk;
+				else mCurrent->next = chunk;
+				mCurrent = chunk;
+				++mChunkCount;
+			}
+
+			mChunkIndex = mCurrent == mChunks ? 0 : mChunkIndex + 1;
+			mTop = mCurrent->begin();
+			mEnd = mCurrent->end();
+			return true;
+		}
+
+		void* allocateLarge(const uint32_t aBytes, const size_t aAlignment) throw() {
+			Chunk* const chunk = createChunk(aBytes + HEADER_SIZE + aAlignment);
+			if(chunk == nullptr) return nullptr;
+			chunk->next = mLargeChunks;
+			mLargeChunks = chunk;
+
+			const uintptr_t block = alignBlock(chunk->begin(), aAlignment);
+			*reinterpret_cast<uint32_t*>(block - HEADER_SIZE) = aBytes;
+			mAllocatedBytes += aBytes;
+			return reinterpret_cast<void*>(block);
+		}
+	public:
+		ArenaAllocator(const uint32_t aChunkSize = DEFAULT_CHUNK_SIZE) throw() :
+			mChunks(nullptr),
+			mCurrent(nullptr),
+			mLargeChunks(nullptr),
+			mTop(0),
+			mEnd(0),
+			mChunkSize(aChunkSize),
+			mChunkCount(0),
+			mChunkIndex(0),
+			mAllocatedBytes(0)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~ArenaAllocator() throw() {
+			destroyChunks(mChunks);
+			destroyChunks(mLargeChunks);
+		}
+
+		uint32_t getChunkSize() const throw() {
+			return mChunkSize;
+		}
+
+		// Inherited from Allocator
+
+		uint32_t SOLAIRE_EXPORT_CALL getAllocatedBytes() const throw() override {
+			return mAllocatedBytes;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL getFreeBytes() const throw() override {
+			// Bytes that can be handed out without acquiring another chunk from the system
+			const uint64_t idleChunks = mCurrent == nullptr ? mChunkCount : mChunkCount - (mChunkIndex + 1);
+			const uint64_t free = static_cast<uint64_t>(mEnd - mTop) + idleChunks * mChunkSize;
+			return free > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(free);
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL sizeOf(const void* const aObject) throw() override {
+			if(aObject == nullptr) return 0;
+			return *reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(aObject) - HEADER_SIZE);
+		}
+
+		void* SOLAIRE_EXPORT_CALL allocate(const size_t aBytes) throw() override {
+			return allocateAligned(aBytes, ALIGNMENT);
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject) throw() override {
+			if(aObject == nullptr) return false;
+			const uintptr_t block = reinterpret_cast<uintptr_t>(aObject);
+			const uint32_t bytes = *reinterpret_cast<const uint32_t*>(block - HEADER_SIZE);
+			mAllocatedBytes -= bytes;
+
+			// The most recent allocation can be handed back immediately
+			if(block + bytes == mTop) mTop = block - HEADER_SIZE;
+			return true;
+		}
+
+		void* SOLAIRE_EXPORT_CALL allocateAligned(const size_t aBytes, const size_t aAlignment) throw() override {
+			const size_t alignment = aAlignment < static_cast<size_t>(ALIGNMENT) ? static_cast<size_t>(ALIGNMENT) : aAlignment;
+			if(aBytes > UINT32_MAX - (HEADER_SIZE + alignment)) return nullptr;
+			const uint32_t bytes = static_cast<uint32_t>(aBytes);
+			if(bytes + HEADER_SIZE + alignment > mChunkSize) return allocateLarge(bytes, alignment);
+
+			uintptr_t block = alignBlock(mTop, alignment);
+			if(block + bytes > mEnd) {
+				if(! nextChunk()) return nullptr;
+				block = alignBlock(mTop, alignment);
+			}
+
+			*reinterpret_cast<uint32_t*>(block - HEADER_SIZE) = bytes;
+			mTop = block + bytes;
+			mAllocatedBytes += bytes;
+			return reinterpret_cast<void*>(block);
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject, const size_t) throw() override {
+			return deallocate(aObject);
+		}
+
+		void* SOLAIRE_EXPORT_CALL reallocate(const void* const aObject, const size_t aBytes) throw() override {
+			if(aObject == nullptr) return allocate(aBytes);
+			if(aBytes > UINT32_MAX - (HEADER_SIZE + ALIGNMENT)) return nullptr;
+			const uintptr_t block = reinterpret_cast<uintptr_t>(aObject);
+			uint32_t& bytes = *reinterpret_cast<uint32_t*>(block - HEADER_SIZE);
+
+			// Blocks shrink in place, and the most recent allocation can also grow in place
+			const bool top = block + bytes == mTop;
+			if(aBytes <= bytes || (top && block + aBytes <= mEnd)) {
+				mAllocatedBytes = mAllocatedBytes - bytes + static_cast<uint32_t>(aBytes);
+				bytes = static_cast<uint32_t>(aBytes);
+				if(top) mTop = block + bytes;
+				return const_cast<void*>(aObject);
+			}
+
+			void* const tmp = allocate(aBytes);
+			if(tmp == nullptr) return nullptr;
+			std::memcpy(tmp, aObject, bytes);
+			deallocate(aObject);
+			return tmp;
+		}
+
+		bool SOLAIRE_EXPORT_CALL allocateBatch(const size_t aBytes, const uint32_t aCount, void** const aOut) throw() override {
+			for(uint32_t i = 0; i < aCount; ++i) {
+				aOut[i] = ArenaAllocator::allocateAligned(aBytes, ALIGNMENT);
+				if(aOut[i] == nullptr) {
+					ArenaAllocator::deallocateBatch(aOut, i);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocateBatch(void* const* const aObjects, const uint32_t aCount) throw() override {
+			// Release in reverse order so that blocks at the top of the arena are reclaimed
+			bool result = true;
+			for(uint32_t i = aCount; i > 0; --i) {
+				if(! ArenaAllocator::deallocate(aObjects[i - 1])) result = false;
+			}
+			return result;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocateAll() throw() override {
+			destroyChunks(mLargeChunks);
+			mLargeChunks = nullptr;
+
+			mCurrent = nullptr;
+			mChunkIndex = 0;
+			mTop = 0;
+			mEnd = 0;
+			mAllocatedBytes = 0;
+			return true;
+		}
+	};
+
+}
+#endif
@@ -0,0 +1,736 @@
+#ifndef SOLAIRE_BTREE_MAP_HPP
+#define SOLAIRE_BTREE_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file BTreeMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <type_traits>
+#include "Solaire/Core/FlatMap.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class BTreeMap
+		\brief A Map that stores its entries in a B+ tree with wide nodes.
+		\detail Every entry lives in a leaf and the leaves are linked in key order, so range scans never revisit the inner nodes.
+		Inner nodes only hold keys, so descending the tree never touches values. Leaves hold each entry as a
+		Map::Entry, so getEntries views them in place.
+		Nodes are split when they fill. When an erase leaves a node less than half full it borrows an entry from a
+		sibling, or is merged with it if the sibling has none to spare.
+		\tparam K The key type.
+		\tparam T The value type.
+		\tparam COMPARE The ordering of \a K.
+		\tparam NODE_SIZE The maximum number of entries in a leaf and children of an inner node.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see FlatMap
+	*/
+	template<class K, class T, class COMPARE = std::less<K>, uint32_t NODE_SIZE = 32>
+	class BTreeMap : public Map<K, T> {
+	public:
+		typedef typename Map<K, T>::Entry Entry;
+		typedef BTreeMap<K, T, COMPARE, NODE_SIZE> Self;
+	private:
+		static_assert(NODE_SIZE >= 4, "SolaireCPP : BTreeMap NODE_SIZE must be at least 4");
+
+		enum : uint32_t {
+			MAX_DEPTH = 32,
+			// Every node other than the root is kept at least half full
+			MIN_LEAF_COUNT = NODE_SIZE / 2,
+			MIN_INNER_COUNT = NODE_SIZE / 2 - 1
+		};
+
+		template<class X>
+		struct Slot {
+			typename std::aligned_storage<sizeof(X), alignof(X)>::type storage;
+
+			SOLAIRE_FORCE_INLINE X& get() throw() {
+				return *reinterpret_cast<X*>(&storage);
+			}
+
+			SOLAIRE_FORCE_INLINE const X& get() const throw() {
+				return *reinterpret_cast<const X*>(&storage);
+			}
+		};
+
+		struct Node {
+			bool leaf;
+			uint32_t count;
+		};
+
+		struct Leaf : public Node {
+			Leaf* previous;
+			Leaf* next;
+			Slot<Entry> entries[NODE_SIZE];
+		};
+
+		struct Inner : public Node {
+			// Inner nodes hold count keys and count + 1 children, keys[i] is the smallest key in children[i + 1]
+			Slot<K> keys[NODE_SIZE - 1];
+			Node* children[NODE_SIZE];
+		};
+	public:
+		/*!
+			\class CursorType
+			\brief A position in the leaf level of a BTreeMap.
+			\detail A cursor is invalidated by any modification of the map.
+			\tparam V The value type, which is const for cursors obtained from a const map.
+			\see Cursor
+			\see ConstCursor
+		*/
+		template<class V>
+		class CursorType {
+		public:
+			friend class BTreeMap<K, T, COMPARE, NODE_SIZE>;
+
+			template<class V2>
+			friend class CursorType;
+		private:
+			Leaf* mLeaf;
+			uint32_t mIndex;
+		private:
+			CursorType(Leaf* const aLeaf, const uint32_t aIndex) throw() :
+				mLeaf(aLeaf),
+				mIndex(aIndex)
+			{
+				normalise();
+			}
+
+			void normalise() throw() {
+				while(mLeaf && mIndex >= mLeaf->count) {
+					mLeaf = mLeaf->next;
+					mIndex = 0;
+				}
+			}
+		public:
+			CursorType(const CursorType<typename std::remove_const<V>::type>& aOther) throw() :
+				mLeaf(aOther.mLeaf),
+				mIndex(aOther.mIndex)
+			{}
+
+			bool isValid() const throw() {
+				return mLeaf != nullptr;
+			}
+
+			const K& getKey() const throw() {
+				return mLeaf->entries[mIndex].get().first;
+			}
+
+			V& getValue() const throw() {
+				return mLeaf->entries[mIndex].get().second;
+			}
+
+			CursorType<V>& next() throw() {
+				++mIndex;
+				normalise();
+				return *this;
+			}
+
+			bool operator==(const CursorType<V>& aOther) const throw() {
+				return mLeaf == aOther.mLeaf && (mLeaf == nullptr || mIndex == aOther.mIndex);
+			}
+
+			bool operator!=(const CursorType<V>& aOther) const throw() {
+				return ! operator==(aOther);
+			}
+		};
+
+		typedef CursorType<T> Cursor;
+		typedef CursorType<const T> ConstCursor;
+	private:
+		/*
+			Finds the leaf that holds an index of the leaf level.
+			The last leaf is cached so that a sequential scan only follows each link once.
+		*/
+		class LeafSource {
+		private:
+			Leaf* mFirst;
+			Leaf* mLeaf;
+			int32_t mBegin;
+			int32_t mSize;
+		protected:
+			SOLAIRE_FORCE_INLINE Leaf& leaf() const throw() {
+				return *mLeaf;
+			}
+
+			uint32_t seek(const int32_t aIndex) throw() {
+				if(aIndex < mBegin && aIndex < mBegin - aIndex) {
+					// Walking forwards from the first leaf is shorter than walking backwards
+					mLeaf = mFirst;
+					mBegin = 0;
+				}
+				while(aIndex >= mBegin + static_cast<int32_t>(mLeaf->count)) {
+					mBegin += mLeaf->count;
+					mLeaf = mLeaf->next;
+				}
+				while(aIndex < mBegin) {
+					mLeaf = mLeaf->previous;
+					mBegin -= mLeaf->count;
+				}
+				return static_cast<uint32_t>(aIndex - mBegin);
+			}
+		public:
+			LeafSource(const Self& aMap) throw() :
+				mFirst(aMap.mFirst),
+				mLeaf(aMap.mFirst),
+				mBegin(0),
+				mSize(aMap.mSize)
+			{}
+
+			SOLAIRE_FORCE_INLINE int32_t size() const throw() {
+				return mSize;
+			}
+
+			SOLAIRE_FORCE_INLINE bool isContiguous() const throw() {
+				return false;
+			}
+		};
+
+		class KeySource : public LeafSource {
+		public:
+			typedef const K Type;
+		public:
+			KeySource(const Self& aMap) throw() :
+				LeafSource(aMap)
+			{}
+
+			SOLAIRE_FORCE_INLINE const K* getPtr(const int32_t aIndex) throw() {
+				const uint32_t i = this->seek(aIndex);
+				return &this->leaf().entries[i].get().first;
+			}
+		};
+
+		class ValueSource : public LeafSource {
+		public:
+			typedef const T Type;
+		public:
+			ValueSource(const Self& aMap) throw() :
+				LeafSource(aMap)
+			{}
+
+			SOLAIRE_FORCE_INLINE const T* getPtr(const int32_t aIndex) throw() {
+				const uint32_t i = this->seek(aIndex);
+				return &this->leaf().entries[i].get().second;
+			}
+		};
+
+		class EntrySource : public LeafSource {
+		public:
+			typedef const Entry Type;
+		public:
+			EntrySource(const Self& aMap) throw() :
+				LeafSource(aMap)
+			{}
+
+			SOLAIRE_FORCE_INLINE const Entry* getPtr(const int32_t aIndex) throw() {
+				const uint32_t i = this->seek(aIndex);
+				return &this->leaf().entries[i].get();
+			}
+		};
+	private:
+		Allocator& mAllocator;
+		Node* mRoot;
+		Leaf* mFirst;
+		int32_t mSize;
+		COMPARE mCompare;
+	private:
+		template<class X>
+		static SOLAIRE_FORCE_INLINE void moveSlot(Slot<X>& aDst, Slot<X>& aSrc) throw() {
+			new(&aDst.storage) X(std::move(aSrc.get()));
+			aSrc.get().~X();
+		}
+
+		template<class X>
+		static void shiftRight(Slot<X>* const aSlots, const uint32_t aBegin, const uint32_t aEnd) throw() {
+			// Moves [aBegin, aEnd) up by one, leaving aBegin uninitialised
+			for(uint32_t i = aEnd; i > aBegin; --i) moveSlot(aSlots[i], aSlots[i - 1]);
+		}
+
+		template<class X>
+		static void shiftLeft(Slot<X>* const aSlots, const uint32_t aBegin, const uint32_t aEnd) throw() {
+			// Moves [aBegin + 1, aEnd) down by one, aBegin must already be uninitialised
+			for(uint32_t i = aBegin; i + 1 < aEnd; ++i) moveSlot(aSlots[i], aSlots[i + 1]);
+		}
+
+		template<class NODE>
+		NODE* allocateNode() throw() {
+			void* const block = alignof(NODE) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+				mAllocator.allocateAligned(sizeof(NODE), alignof(NODE)) :
+				mAllocator.allocate(sizeof(NODE));
+			// There is no way to report a failed insertion through the Map interface
+			if(block == nullptr) std::terminate();
+			NODE* const node = static_cast<NODE*>(block);
+			node->leaf = std::is_same<NODE, Leaf>::value;
+			node->count = 0;
+			return node;
+		}
+
+		void destroyNode(Node* const aNode) throw() {
+			if(aNode->leaf) {
+				Leaf* const leaf = static_cast<Leaf*>(aNode);
+				for(uint32_t i = 0; i < leaf->count; ++i) leaf->entries[i].get().~Entry();
+			}else {
+				Inner* const inner = static_cast<Inner*>(aNode);
+				for(uint32_t i = 0; i < inner->count; ++i) inner->keys[i].get().~K();
+				for(uint32_t i = 0; i <= inner->count; ++i) destroyNode(inner->children[i]);
+			}
+			mAllocator.deallocate(aNode);
+		}
+
+		uint32_t leafLowerBound(const Leaf& aLeaf, const K& aKey) const throw() {
+			const COMPARE& compare = mCompare;
+			return Implementation::branchlessLowerBound(aLeaf.count, [&aLeaf, &compare, &aKey](const uint32_t aIndex) {
+				return compare(aLeaf.entries[aIndex].get().first, aKey);
+			});
+		}
+
+		uint32_t childIndex(const Inner& aInner, const K& aKey) const throw() {
+			// The first separator greater than the key selects the child
+			const COMPARE& compare = mCompare;
+			return Implementation::branchlessLowerBound(aInner.count, [&aInner, &compare, &aKey](const uint32_t aIndex) {
+				return ! compare(aKey, aInner.keys[aIndex].get());
+			});
+		}
+
+		Leaf* findLeaf(const K& aKey) const throw() {
+			Node* node = mRoot;
+			if(node == nullptr) return nullptr;
+			while(! node->leaf) {
+				const Inner* const inner = static_cast<const Inner*>(node);
+				node = inner->children[childIndex(*inner, aKey)];
+			}
+			return static_cast<Leaf*>(node);
+		}
+
+		bool isFull(const Node& aNode) const throw() {
+			return aNode.leaf ? aNode.count == NODE_SIZE : aNode.count == NODE_SIZE - 1;
+		}
+
+		void splitChild(Inner& aParent, const uint32_t aIndex) throw() {
+			Node* const child = aParent.children[aIndex];
+			Node* right;
+
+			if(child->leaf) {
+				Leaf* const left = static_cast<Leaf*>(child);
+				Leaf* const leaf = allocateNode<Leaf>();
+				const uint32_t mid = left->count / 2;
+				for(uint32_t i = mid; i < left->count; ++i) moveSlot(leaf->entries[i - mid], left->entries[i]);
+				leaf->count = left->count - mid;
+				left->count = mid;
+
+				leaf->previous = left;
+				leaf->next = left->next;
+				if(left->next) left->next->previous = leaf;
+				left->next = leaf;
+
+				// Leaves keep every key, so the separator is a copy of the right leaf's first key
+				right = leaf;
+				shiftRight(aParent.keys, aIndex, aParent.count);
+				new(&aParent.keys[aIndex].storage) K(leaf->entries[0].get().first);
+			}else {
+				Inner* const left = static_cast<Inner*>(child);
+				Inner* const inner = allocateNode<Inner>();
+				const uint32_t mid = left->count / 2;
+				for(uint32_t i = mid + 1; i < left->count; ++i) moveSlot(inner->keys[i - mid - 1], left->keys[i]);
+				for(uint32_t i = mid + 1; i <= left->count; ++i) inner->children[i - mid - 1] = left->children[i];
+				inner->count = left->count - mid - 1;
+
+				// The middle separator moves up into the parent
+				right = inner;
+				shiftRight(aParent.keys, aIndex, aParent.count);
+				moveSlot(aParent.keys[aIndex], left->keys[mid]);
+				left->count = mid;
+			}
+
+			for(uint32_t i = aParent.count + 1; i > aIndex + 1; --i) aParent.children[i] = aParent.children[i - 1];
+			aParent.children[aIndex + 1] = right;
+			++aParent.count;
+		}
+
+		/*!
+			\brief Remove a child that has been released from an inner node.
+		*/
+		void removeChild(Inner& aParent, const uint32_t aIndex) throw() {
+			// Removing child i also removes the separator before it, or the one after it for the first child
+			const uint32_t key = aIndex == 0 ? 0 : aIndex - 1;
+			aParent.keys[key].get().~K();
+			shiftLeft(aParent.keys, key, aParent.count);
+			for(uint32_t i = aIndex; i < aParent.count; ++i) aParent.children[i] = aParent.children[i + 1];
+			--aParent.count;
+		}
+
+		void borrowFromLeft(Inner& aParent, const uint32_t aIndex) throw() {
+			Node* const child = aParent.children[aIndex];
+			Node* const sibling = aParent.children[aIndex - 1];
+
+			if(child->leaf) {
+				Leaf* const leaf = static_cast<Leaf*>(child);
+				Leaf* const left = static_cast<Leaf*>(sibling);
+				shiftRight(leaf->entries, 0, leaf->count);
+				moveSlot(leaf->entries[0], left->entries[left->count - 1]);
+				aParent.keys[aIndex - 1].get() = leaf->entries[0].get().first;
+			}else {
+				// The separator rotates down into the child and the sibling's last key replaces it
+				Inner* const inner = static_cast<Inner*>(child);
+				Inner* const left = static_cast<Inner*>(sibling);
+				shiftRight(inner->keys, 0, inner->count);
+				for(uint32_t i = inner->count + 1; i > 0; --i) inner->children[i] = inner->children[i - 1];
+				moveSlot(inner->keys[0], aParent.keys[aIndex - 1]);
+				inner->children[0] = left->children[left->count];
+				moveSlot(aParent.keys[aIndex - 1], left->keys[left->count - 1]);
+			}
+
+			--sibling->count;
+			++child->count;
+		}
+
+		void borrowFromRight(Inner& aParent, const uint32_t aIndex) throw() {
+			Node* const child = aParent.children[aIndex];
+			Node* const sibling = aParent.children[aIndex + 1];
+
+			if(child->leaf) {
+				Leaf* const leaf = static_cast<Leaf*>(child);
+				Leaf* const right = static_cast<Leaf*>(sibling);
+				moveSlot(leaf->entries[leaf->count], right->entries[0]);
+				shiftLeft(right->entries, 0, right->count);
+				aParent.keys[aIndex].get() = right->entries[0].get().first;
+			}else {
+				Inner* const inner = static_cast<Inner*>(child);
+				Inner* const right = static_cast<Inner*>(sibling);
+				moveSlot(inner->keys[inner->count], aParent.keys[aIndex]);
+				inner->children[inner->count + 1] = right->children[0];
+				moveSlot(aParent.keys[aIndex], right->keys[0]);
+				shiftLeft(right->keys, 0, right->count);
+				for(uint32_t i = 0; i < right->count; ++i) right->children[i] = right->children[i + 1];
+			}
+
+			--sibling->count;
+			++child->count;
+		}
+
+		/*!
+			\brief Move every entry of a child into its left sibling and release it.
+			\param aIndex The index of the left sibling.
+		*/
+		void mergeChildren(Inner& aParent, const uint32_t aIndex) throw() {
+			Node* const child = aParent.children[aIndex];
+			Node* const sibling = aParent.children[aIndex + 1];
+
+			if(child->leaf) {
+				Leaf* const left = static_cast<Leaf*>(child);
+				Leaf* const right = static_cast<Leaf*>(sibling);
+				for(uint32_t i = 0; i < right->count; ++i) moveSlot(left->entries[left->count + i], right->entries[i]);
+				left->count += right->count;
+
+				left->next = right->next;
+				if(right->next) right->next->previous = left;
+			}else {
+				// Inner nodes don't repeat their children's keys, so the separator is brought down between them
+				Inner* const left = static_cast<Inner*>(child);
+				Inner* const right = static_cast<Inner*>(sibling);
+				new(&left->keys[left->count].storage) K(std::move(aParent.keys[aIndex].get()));
+				for(uint32_t i = 0; i < right->count; ++i) moveSlot(left->keys[left->count + 1 + i], right->keys[i]);
+				for(uint32_t i = 0; i <= right->count; ++i) left->children[left->count + 1 + i] = right->children[i];
+				left->count += right->count + 1;
+			}
+
+			mAllocator.deallocate(sibling);
+			removeChild(aParent, aIndex + 1);
+		}
+
+		/*!
+			\brief Restore the minimum size of a child that has fallen below it.
+			\detail A child of an inner node always has at least one sibling because only the root may hold a single child.
+		*/
+		void rebalanceChild(Inner& aParent, const uint32_t aIndex) throw() {
+			const uint32_t minimum = aParent.children[aIndex]->leaf ? MIN_LEAF_COUNT : MIN_INNER_COUNT;
+			if(aIndex > 0 && aParent.children[aIndex - 1]->count > minimum) {
+				borrowFromLeft(aParent, aIndex);
+			}else if(aIndex < aParent.count && aParent.children[aIndex + 1]->count > minimum) {
+				borrowFromRight(aParent, aIndex);
+			}else {
+				mergeChildren(aParent, aIndex > 0 ? aIndex - 1 : aIndex);
+			}
+		}
+	public:
+		BTreeMap() throw() :
+			mAllocator(getDefaultAllocator()),
+			mRoot(nullptr),
+			mFirst(nullptr),
+			mSize(0),
+			mCompare()
+		{}
+
+		BTreeMap(Allocator& aAllocator) throw() :
+			mAllocator(aAllocator),
+			mRoot(nullptr),
+			mFirst(nullptr),
+			mSize(0),
+			mCompare()
+		{}
+
+		BTreeMap(const Self& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mRoot(nullptr),
+			mFirst(nullptr),
+			mSize(0),
+			mCompare(aOther.mCompare)
+		{
+			operator=(aOther);
+		}
+
+		BTreeMap(Self&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mRoot(aOther.mRoot),
+			mFirst(aOther.mFirst),
+			mSize(aOther.mSize),
+			mCompare(aOther.mCompare)
+		{
+			aOther.mRoot = nullptr;
+			aOther.mFirst = nullptr;
+			aOther.mSize = 0;
+		}
+
+		SOLAIRE_EXPORT_CALL ~BTreeMap() throw() {
+			clear();
+		}
+
+		Self& operator=(const Self& aOther) throw() {
+			if(&aOther == this) return *this;
+			clear();
+			mCompare = aOther.mCompare;
+			for(ConstCursor i = aOther.first(); i.isValid(); i.next()) emplace(i.getKey(), i.getValue());
+			return *this;
+		}
+
+		Self& operator=(Self&& aOther) throw() {
+			if(&mAllocator != &aOther.mAllocator) return operator=(static_cast<const Self&>(aOther));
+			std::swap(mRoot, aOther.mRoot);
+			std::swap(mFirst, aOther.mFirst);
+			std::swap(mSize, aOther.mSize);
+			std::swap(mCompare, aOther.mCompare);
+			return *this;
+		}
+
+		/*!
+			\brief Get a cursor to the entry with the smallest key.
+		*/
+		Cursor first() throw() {
+			return Cursor(mFirst, 0);
+		}
+
+		ConstCursor first() const throw() {
+			return ConstCursor(mFirst, 0);
+		}
+
+		/*!
+			\brief Get a cursor to the first entry whose key is not ordered before \a aKey.
+			\return The cursor, which is invalid if there is no such entry.
+		*/
+		Cursor lowerBound(const K& aKey) throw() {
+			Leaf* const leaf = findLeaf(aKey);
+			return leaf ? Cursor(leaf, leafLowerBound(*leaf, aKey)) : Cursor(nullptr, 0);
+		}
+
+		ConstCursor lowerBound(const K& aKey) const throw() {
+			return const_cast<Self*>(this)->lowerBound(aKey);
+		}
+
+		/*!
+			\brief Get a cursor to the first entry whose key is ordered after \a aKey.
+			\return The cursor, which is invalid if there is no such entry.
+		*/
+		Cursor upperBound(const K& aKey) throw() {
+			Cursor i = lowerBound(aKey);
+			if(i.isValid() && ! mCompare(aKey, i.getKey())) i.next();
+			return i;
+		}
+
+		ConstCursor upperBound(const K& aKey) const throw() {
+			return const_cast<Self*>(this)->upperBound(aKey);
+		}
+
+		/*!
+			\brief Call \a aFunction with every entry whose key is in [aBegin, aEnd).
+			\param aFunction Called in key order with (const K&, T&).
+			\return The number of entries that were visited.
+		*/
+		template<class F>
+		int32_t forEachInRange(const K& aBegin, const K& aEnd, F aFunction) throw() {
+			int32_t count = 0;
+			for(Cursor i = lowerBound(aBegin); i.isValid() && mCompare(i.getKey(), aEnd); i.next()) {
+				aFunction(i.getKey(), i.getValue());
+				++count;
+			}
+			return count;
+		}
+
+		T* find(const K& aKey) throw() {
+			Leaf* const leaf = findLeaf(aKey);
+			if(leaf == nullptr) return nullptr;
+			const uint32_t i = leafLowerBound(*leaf, aKey);
+			return i < leaf->count && ! mCompare(aKey, leaf->entries[i].get().first) ? &leaf->entries[i].get().second : nullptr;
+		}
+
+		const T* find(const K& aKey) const throw() {
+			return const_cast<Self*>(this)->find(aKey);
+		}
+
+		// Inherited from Map
+
+		T& SOLAIRE_EXPORT_CALL emplace(const K& aKey, const T& aValue) throw() override {
+			T* const existing = find(aKey);
+			if(existing) {
+				*existing = aValue;
+				return *existing;
+			}
+
+			if(mRoot == nullptr) {
+				mFirst = allocateNode<Leaf>();
+				mFirst->previous = nullptr;
+				mFirst->next = nullptr;
+				mRoot = mFirst;
+			}else if(isFull(*mRoot)) {
+				Inner* const root = allocateNode<Inner>();
+				root->children[0] = mRoot;
+				mRoot = root;
+				splitChild(*root, 0);
+			}
+
+			// Full children are split on the way down so that a split never has to propagate back up
+			Node* node = mRoot;
+			while(! node->leaf) {
+				Inner* const inner = static_cast<Inner*>(node);
+				uint32_t i = childIndex(*inner, aKey);
+				if(isFull(*inner->children[i])) {
+					splitChild(*inner, i);
+					if(! mCompare(aKey, inner->keys[i].get())) ++i;
+				}
+				node = inner->children[i];
+			}
+
+			Leaf* const leaf = static_cast<Leaf*>(node);
+			const uint32_t i = leafLowerBound(*leaf, aKey);
+			shiftRight(leaf->entries, i, leaf->count);
+			Entry* const entry = new(&leaf->entries[i].storage) Entry(aKey, aValue);
+			++leaf->count;
+			++mSize;
+			return entry->second;
+		}
+
+		const T& SOLAIRE_EXPORT_CALL get(const K& aKey) const throw() override {
+			return const_cast<Self*>(this)->get(aKey);
+		}
+
+		T& SOLAIRE_EXPORT_CALL get(const K& aKey) throw() override {
+			T* const value = find(aKey);
+			// The key must be in the map, there is no value that could be returned otherwise
+			if(value == nullptr) std::terminate();
+			return *value;
+		}
+
+		bool SOLAIRE_EXPORT_CALL contains(const K& aKey) const throw() override {
+			return find(aKey) != nullptr;
+		}
+
+		bool SOLAIRE_EXPORT_CALL erase(const K& aKey) throw() override {
+			if(mRoot == nullptr) return false;
+
+			Inner* path[MAX_DEPTH];
+			uint32_t indices[MAX_DEPTH];
+			uint32_t depth = 0;
+
+			Node* node = mRoot;
+			while(! node->leaf) {
+				Inner* const inner = static_cast<Inner*>(node);
+				const uint32_t i = childIndex(*inner, aKey);
+				path[depth] = inner;
+				indices[depth] = i;
+				++depth;
+				node = inner->children[i];
+			}
+
+			Leaf* const leaf = static_cast<Leaf*>(node);
+			const uint32_t i = leafLowerBound(*leaf, aKey);
+			if(i >= leaf->count || mCompare(aKey, leaf->entries[i].get().first)) return false;
+
+			leaf->entries[i].get().~Entry();
+			shiftLeft(leaf->entries, i, leaf->count);
+			--leaf->count;
+			--mSize;
+
+			// Merging can leave the parent below its minimum too, so the repair may continue up to the root
+			Node* child = leaf;
+			while(depth > 0 && child->count < (child->leaf ? MIN_LEAF_COUNT : MIN_INNER_COUNT)) {
+				--depth;
+				rebalanceChild(*path[depth], indices[depth]);
+				child = path[depth];
+			}
+
+			// Collapse roots that only have one child
+			while(mRoot && ! mRoot->leaf && mRoot->count == 0) {
+				Inner* const root = static_cast<Inner*>(mRoot);
+				mRoot = root->children[0];
+				mAllocator.deallocate(root);
+			}
+			return true;
+		}
+
+		void SOLAIRE_EXPORT_CALL clear() throw() override {
+			if(mRoot) destroyNode(mRoot);
+			mRoot = nullptr;
+			mFirst = nullptr;
+			mSize = 0;
+		}
+
+		int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+			return mSize;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+			return mAllocator;
+		}
+
+		SharedAllocation<StaticContainer<const Entry>> SOLAIRE_EXPORT_CALL getEntries() const throw() override {
+			return makeMapView<EntrySource>(mAllocator, *this);
+		}
+
+		SharedAllocation<StaticContainer<const K>> SOLAIRE_EXPORT_CALL getKeys() const throw() override {
+			return makeMapView<KeySource>(mAllocator, *this);
+		}
+
+		SharedAllocation<StaticContainer<const T>> SOLAIRE_EXPORT_CALL getValues() const throw() override {
+			return makeMapView<ValueSource>(mAllocator, *this);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,632 @@
+#ifndef SOLAIRE_CONCURRENT_HASH_MAP_HPP
+#define SOLAIRE_CONCURRENT_HASH_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ConcurrentHashMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "Solaire/Core/Init.hpp"
+#include "Solaire/Core/FlatHashMap.hpp"
+#include "Solaire/Core/MapView.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class ConcurrentHashMap
+		\brief A Map that can be read by many threads while other threads modify it.
+		\detail Keys are spread over \a SHARDS independent tables, each with its own write lock.
+		When both \a K and \a T are trivially copyable, reads take no lock. They copy the entry out and
+		retry if the shard's sequence number changed during the read. Otherwise reads lock the shard.
+		Lock free readers and the writers they may overlap copy control bytes and slots a word at a time
+		with atomic loads and stores, so the reads are not data races and can be checked with ThreadSanitizer.
+		When reads are lock free, tables that are replaced by a rehash are kept until the map is destroyed so that a
+		reader never follows a dangling table.
+		The references returned by get and emplace point into the shard's table and are invalidated by any later write
+		to that shard, because a rehash or an erase can move or free the slot. They are not safe to use while other
+		threads are writing to the map, tryGet copies the value out and should be used instead.
+		\tparam K The key type.
+		\tparam T The value type.
+		\tparam HASH The hash function for \a K.
+		\tparam SHARDS The number of independently locked tables, which must be a power of two.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+	*/
+	template<class K, class T, class HASH = std::hash<K>, uint32_t SHARDS = 64>
+	class ConcurrentHashMap : public Map<K, T> {
+	public:
+		typedef typename Map<K, T>::Entry Entry;
+		typedef ConcurrentHashMap<K, T, HASH, SHARDS> Self;
+	private:
+		typedef Implementation::HashGroup Group;
+
+		static_assert(SHARDS > 0 && (SHARDS & (SHARDS - 1)) == 0, "SolaireCPP : ConcurrentHashMap SHARDS must be a power of two");
+
+		enum : uint32_t {
+			MIN_CAPACITY = Group::WIDTH,
+			MAX_CAPACITY = 1u << 30,
+			CACHE_LINE_SIZE = 64
+		};
+
+		enum : bool {
+			LOCK_FREE_READS = std::is_trivially_copyable<K>::value && std::is_trivially_copyable<T>::value
+		};
+
+		typedef std::atomic<uintptr_t> Word;
+
+		enum : uint32_t {
+			WORD_SIZE = sizeof(uintptr_t),
+			// Lock free slots are padded to whole words so that they can be copied with atomic word operations
+			SLOT_ALIGNMENT = alignof(K) > alignof(T) ?
+				(LOCK_FREE_READS && alignof(K) < WORD_SIZE ? WORD_SIZE : alignof(K)) :
+				(LOCK_FREE_READS && alignof(T) < WORD_SIZE ? WORD_SIZE : alignof(T)),
+			GROUP_WORDS = Group::WIDTH / WORD_SIZE
+		};
+
+		struct alignas(SLOT_ALIGNMENT) Slot {
+			K key;
+			T value;
+		};
+
+		typedef typename std::aligned_storage<sizeof(Slot), alignof(Slot)>::type SlotBuffer;
+
+		struct Table {
+			Table* previous;
+			Slot* slots;
+			uint8_t* control;
+			uint32_t capacity;
+		};
+
+		struct Shard {
+			std::mutex lock;
+			std::atomic<uint32_t> sequence;
+			std::atomic<Table*> table;
+			std::atomic<int32_t> size;
+			uint8_t padding[CACHE_LINE_SIZE];
+		};
+	private:
+		Allocator& mAllocator;
+		Shard mShards[SHARDS];
+		HASH mHash;
+	private:
+		SOLAIRE_FORCE_INLINE uint64_t hashOf(const K& aKey) const throw() {
+			uint64_t hash = static_cast<uint64_t>(mHash(aKey)) * 0x9E3779B97F4A7C15ull;
+			return hash ^ (hash >> 29);
+		}
+
+		SOLAIRE_FORCE_INLINE Shard& shardOf(const uint64_t aHash) const throw() {
+			// The top bits pick the shard, the bottom bits are used inside the table
+			return const_cast<Shard&>(mShards[static_cast<uint32_t>(aHash >> 40) & (SHARDS - 1)]);
+		}
+
+		static SOLAIRE_FORCE_INLINE uint8_t controlOf(const uint64_t aHash) throw() {
+			return static_cast<uint8_t>(aHash & 0x7F);
+		}
+
+		static SOLAIRE_FORCE_INLINE void loadWords(void* const aDst, const void* const aSrc, const uint32_t aWords) throw() {
+			// Acquire loads order the copy before the reader checks the sequence number again
+			const Word* const src = static_cast<const Word*>(aSrc);
+			uintptr_t* const dst = static_cast<uintptr_t*>(aDst);
+			for(uint32_t i = 0; i < aWords; ++i) dst[i] = src[i].load(std::memory_order_acquire);
+		}
+
+		static SOLAIRE_FORCE_INLINE void storeWords(void* const aDst, const void* const aSrc, const uint32_t aWords) throw() {
+			// Release stores keep a reader that sees the new words from missing the odd sequence number before them
+			const uintptr_t* const src = static_cast<const uintptr_t*>(aSrc);
+			Word* const dst = static_cast<Word*>(aDst);
+			for(uint32_t i = 0; i < aWords; ++i) dst[i].store(src[i], std::memory_order_release);
+		}
+
+		static SOLAIRE_FORCE_INLINE void storeControl(Table& aTable, const uint32_t aIndex, const uint8_t aByte) throw() {
+			if(LOCK_FREE_READS) {
+				// Only the writer holding the shard lock modifies the word, so a load and store can't lose an update
+				uintptr_t word;
+				loadWords(&word, aTable.control + aIndex - aIndex % WORD_SIZE, 1);
+				reinterpret_cast<uint8_t*>(&word)[aIndex % WORD_SIZE] = aByte;
+				storeWords(aTable.control + aIndex - aIndex % WORD_SIZE, &word, 1);
+			}else {
+				aTable.control[aIndex] = aByte;
+			}
+		}
+
+		static SOLAIRE_FORCE_INLINE void setControl(Table& aTable, const uint32_t aSlot, const uint8_t aByte) throw() {
+			storeControl(aTable, aSlot, aByte);
+			if(aSlot < Group::WIDTH - 1) storeControl(aTable, aTable.capacity + aSlot, aByte);
+		}
+
+		static SOLAIRE_FORCE_INLINE uint32_t controlBytes(const uint32_t aCapacity) throw() {
+			return aCapacity + Group::WIDTH;
+		}
+
+		static SOLAIRE_FORCE_INLINE uint32_t homeOf(const uint64_t aHash, const uint32_t aMask) throw() {
+			// Lock free probes start on a word boundary so that every group is loaded as whole aligned words
+			const uint32_t home = static_cast<uint32_t>(aHash >> 7) & aMask;
+			return LOCK_FREE_READS ? home & ~static_cast<uint32_t>(WORD_SIZE - 1) : home;
+		}
+
+		/*!
+			\brief Load the control bytes of the group that starts at a slot.
+			\param aBuffer Holds a copy of the bytes when reads are lock free.
+		*/
+		static SOLAIRE_FORCE_INLINE Group loadGroup(const Table& aTable, const uint32_t aPos, uintptr_t* const aBuffer) throw() {
+			if(! LOCK_FREE_READS) return Group(aTable.control + aPos);
+			#if defined(SOLAIRE_FLAT_HASH_SSE2) && UINTPTR_MAX == UINT64_MAX
+				// Building the group in registers avoids a 16 byte load from a copy, which would stall on the 8 byte stores
+				static_cast<void>(aBuffer);
+				const Word* const words = reinterpret_cast<const Word*>(aTable.control + aPos);
+				return Group(words[0].load(std::memory_order_acquire), words[1].load(std::memory_order_acquire));
+			#else
+				loadWords(aBuffer, aTable.control + aPos, GROUP_WORDS);
+				return Group(reinterpret_cast<const uint8_t*>(aBuffer));
+			#endif
+		}
+
+		static SOLAIRE_FORCE_INLINE const Slot& loadSlot(const Table& aTable, const uint32_t aSlot, SlotBuffer& aBuffer) throw() {
+			if(! LOCK_FREE_READS) return aTable.slots[aSlot];
+			loadWords(&aBuffer, aTable.slots + aSlot, sizeof(Slot) / WORD_SIZE);
+			return *reinterpret_cast<const Slot*>(&aBuffer);
+		}
+
+		// Only used when reads are lock free, the slot is trivially copyable so it doesn't need to be constructed
+		static SOLAIRE_FORCE_INLINE void storeSlot(Table& aTable, const uint32_t aSlot, const Slot& aValue) throw() {
+			storeWords(aTable.slots + aSlot, &aValue, sizeof(Slot) / WORD_SIZE);
+		}
+
+		static bool findSlot(const Table& aTable, const K& aKey, const uint64_t aHash, uint32_t& aSlot) throw() {
+			const uint8_t control = controlOf(aHash);
+			const uint32_t mask = aTable.capacity - 1;
+			uint32_t pos = homeOf(aHash, mask);
+			// Bounded so that a reader that sees a table mid-write can't probe forever, it will retry anyway
+			uintptr_t buffer[GROUP_WORDS];
+			for(uint32_t groups = aTable.capacity / Group::WIDTH + 1; groups > 0; --groups) {
+				const Group group = loadGroup(aTable, pos, buffer);
+				const uint32_t empty = group.matchEmpty();
+				const uint32_t limit = empty == 0 ? 0xFFFFFFFF : (1u << Group::lowestBit(empty)) - 1;
+				uint32_t matches = group.match(control) & limit;
+				while(matches != 0) {
+					const uint32_t slot = (pos + Group::lowestBit(matches)) & mask;
+					SlotBuffer copy;
+					if(loadSlot(aTable, slot, copy).key == aKey) {
+						aSlot = slot;
+						return true;
+					}
+					matches &= matches - 1;
+				}
+				if(empty != 0) {
+					aSlot = (pos + Group::lowestBit(empty)) & mask;
+					return false;
+				}
+				pos = (pos + Group::WIDTH) & mask;
+			}
+			return false;
+		}
+
+		Table* allocateTable(const uint32_t aCapacity) throw() {
+			const size_t slotOffset = (sizeof(Table) + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+			const size_t slotBytes = sizeof(Slot) * static_cast<size_t>(aCapacity);
+			const size_t bytes = slotOffset + slotBytes + controlBytes(aCapacity);
+			uint8_t* const block = static_cast<uint8_t*>(alignof(Slot) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+				mAllocator.allocateAligned(bytes, alignof(Slot)) :
+				mAllocator.allocate(bytes)
+			);
+			if(block == nullptr) return nullptr;
+
+			Table* const table = reinterpret_cast<Table*>(block);
+			table->previous = nullptr;
+			table->slots = reinterpret_cast<Slot*>(block + slotOffset);
+			table->control = block + slotOffset + slotBytes;
+			table->capacity = aCapacity;
+			std::memset(table->control, Group::EMPTY, controlBytes(aCapacity));
+			return table;
+		}
+
+		static void destroySlots(Table& aTable) throw() {
+			if(std::is_trivially_destructible<Slot>::value) return;
+			for(uint32_t i = 0; i < aTable.capacity; ++i) {
+				if(aTable.control[i] != Group::EMPTY) aTable.slots[i].~Slot();
+			}
+		}
+
+		// Must be called inside a write section
+		Table& growFor(Shard& aShard, const int32_t aCount) throw() {
+			Table* const table = aShard.table.load(std::memory_order_relaxed);
+			const uint64_t required = static_cast<uint64_t>(aShard.size.load(std::memory_order_relaxed) + aCount);
+			const uint32_t oldCapacity = table ? table->capacity : 0;
+			if(required * 8 <= static_cast<uint64_t>(oldCapacity) * 7) return *table;
+
+			uint32_t capacity = oldCapacity < MIN_CAPACITY ? static_cast<uint32_t>(MIN_CAPACITY) : oldCapacity;
+			while(required * 8 > static_cast<uint64_t>(capacity) * 7) {
+				if(capacity >= MAX_CAPACITY) std::terminate();
+				capacity *= 2;
+			}
+
+			Table* const next = allocateTable(capacity);
+			// There is no way to report a failed insertion through the Map interface
+			if(next == nullptr) std::terminate();
+
+			if(table) {
+				for(uint32_t i = 0; i < table->capacity; ++i) {
+					if(table->control[i] == Group::EMPTY) continue;
+					const uint64_t hash = hashOf(table->slots[i].key);
+					uint32_t slot;
+					findSlot(*next, table->slots[i].key, hash, slot);
+					new(next->slots + slot) Slot(table->slots[i]);
+					setControl(*next, slot, controlOf(hash));
+				}
+			}
+
+			if(table && ! LOCK_FREE_READS) {
+				// Readers hold the lock, so only references from get and emplace can still point here, and those are invalidated by writes
+				destroySlots(*table);
+				mAllocator.deallocate(table);
+			}else {
+				// The old table may still be read by a lock free reader so it is only released by the destructor
+				next->previous = table;
+			}
+			aShard.table.store(next, std::memory_order_release);
+			return *next;
+		}
+
+		static void beginWrite(Shard& aShard) throw() {
+			// The release stores of the slots and control bytes keep this ahead of them
+			aShard.sequence.store(aShard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+
+		static void endWrite(Shard& aShard) throw() {
+			aShard.sequence.store(aShard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		T& emplaceLocked(Shard& aShard, const K& aKey, const T& aValue, const uint64_t aHash) throw() {
+			Table* table = aShard.table.load(std::memory_order_relaxed);
+			uint32_t slot;
+			if(table && findSlot(*table, aKey, aHash, slot)) {
+				if(LOCK_FREE_READS) storeSlot(*table, slot, Slot{aKey, aValue});
+				else table->slots[slot].value = aValue;
+				return table->slots[slot].value;
+			}
+
+			table = &growFor(aShard, 1);
+			findSlot(*table, aKey, aHash, slot);
+			if(LOCK_FREE_READS) storeSlot(*table, slot, Slot{aKey, aValue});
+			else new(table->slots + slot) Slot{aKey, aValue};
+			setControl(*table, slot, controlOf(aHash));
+			aShard.size.fetch_add(1, std::memory_order_relaxed);
+			return table->slots[slot].value;
+		}
+
+		/*!
+			\brief Read the value stored with a key without locking the shard.
+			\detail The read is repeated until no writer modified the shard while it was in progress.
+		*/
+		template<class F>
+		bool readUnlocked(const K& aKey, F aRead) const throw() {
+			const uint64_t hash = hashOf(aKey);
+			Shard& shard = shardOf(hash);
+			while(true) {
+				const uint32_t sequence = shard.sequence.load(std::memory_order_acquire);
+				if(sequence & 1) {
+					std::this_thread::yield();
+					continue;
+				}
+
+				bool found = false;
+				const Table* const table = shard.table.load(std::memory_order_acquire);
+				uint32_t slot;
+				if(table && findSlot(*table, aKey, hash, slot)) {
+					SlotBuffer copy;
+					aRead(loadSlot(*table, slot, copy).value);
+					found = true;
+				}
+
+				// The acquire loads of the copy keep them ahead of this check
+				if(shard.sequence.load(std::memory_order_relaxed) == sequence) return found;
+			}
+		}
+
+		template<class F>
+		bool readLocked(const K& aKey, F aRead) const throw() {
+			const uint64_t hash = hashOf(aKey);
+			Shard& shard = shardOf(hash);
+			SolaireSynchronized(shard.lock,
+				const Table* const table = shard.table.load(std::memory_order_relaxed);
+				uint32_t slot;
+				if(table && findSlot(*table, aKey, hash, slot)) {
+					aRead(table->slots[slot].value);
+					return true;
+				}
+				return false;
+			);
+		}
+
+		template<class F>
+		SOLAIRE_FORCE_INLINE bool read(const K& aKey, F aRead) const throw() {
+			return LOCK_FREE_READS ? readUnlocked(aKey, aRead) : readLocked(aKey, aRead);
+		}
+
+		template<class F>
+		void forEachLocked(const F& aFunction) const throw() {
+			for(const Shard& i : mShards) {
+				Shard& shard = const_cast<Shard&>(i);
+				SolaireSynchronized(shard.lock,
+					const Table* const table = shard.table.load(std::memory_order_relaxed);
+					if(table) {
+						for(uint32_t j = 0; j < table->capacity; ++j) {
+							if(table->control[j] != Group::EMPTY) aFunction(table->slots[j]);
+						}
+					}
+				);
+			}
+		}
+
+		ConcurrentHashMap(const Self&) = delete;
+		Self& operator=(const Self&) = delete;
+	public:
+		ConcurrentHashMap() throw() :
+			mAllocator(getDefaultAllocator()),
+			mHash()
+		{
+			for(Shard& i : mShards) {
+				i.sequence = 0;
+				i.table = nullptr;
+				i.size = 0;
+			}
+		}
+
+		ConcurrentHashMap(Allocator& aAllocator) throw() :
+			mAllocator(aAllocator),
+			mHash()
+		{
+			for(Shard& i : mShards) {
+				i.sequence = 0;
+				i.table = nullptr;
+				i.size = 0;
+			}
+		}
+
+		SOLAIRE_EXPORT_CALL ~ConcurrentHashMap() throw() {
+			for(Shard& i : mShards) {
+				// Rehashing copies the slots, so every retained table still holds live objects
+				Table* table = i.table.load(std::memory_order_relaxed);
+				while(table) {
+					Table* const previous = table->previous;
+					destroySlots(*table);
+					mAllocator.deallocate(table);
+					table = previous;
+				}
+			}
+		}
+
+		/*!
+			\brief Copy the value stored with a key.
+			\param aKey The key to look for.
+			\param aValue Set to the value if the key was found.
+			\return True if the key was found.
+		*/
+		bool tryGet(const K& aKey, T& aValue) const throw() {
+			return read(aKey, [&aValue](const T& aStored) {
+				aValue = aStored;
+			});
+		}
+
+		/*!
+			\brief Add several entries, locking each shard at most once.
+			\param aEntries The entries to add.
+			\param aCount The number of entries.
+		*/
+		void emplaceAll(const Entry* const aEntries, const int32_t aCount) throw() {
+			if(aCount <= 0) return;
+
+			// Bucket the entries by shard so that each lock is taken once
+			uint32_t begin[SHARDS + 1] = {};
+			uint64_t* const hashes = static_cast<uint64_t*>(mAllocator.allocate(sizeof(uint64_t) * aCount));
+			int32_t* const order = static_cast<int32_t*>(mAllocator.allocate(sizeof(int32_t) * aCount));
+			if(hashes == nullptr || order == nullptr) {
+				if(hashes) mAllocator.deallocate(hashes);
+				if(order) mAllocator.deallocate(order);
+				for(int32_t i = 0; i < aCount; ++i) emplace(aEntries[i].first, aEntries[i].second);
+				return;
+			}
+
+			for(int32_t i = 0; i < aCount; ++i) {
+				hashes[i] = hashOf(aEntries[i].first);
+				++begin[(&shardOf(hashes[i]) - mShards) + 1];
+			}
+			for(uint32_t i = 0; i < SHARDS; ++i) begin[i + 1] += begin[i];
+			uint32_t next[SHARDS];
+			std::memcpy(next, begin, sizeof(next));
+			for(int32_t i = 0; i < aCount; ++i) order[next[&shardOf(hashes[i]) - mShards]++] = i;
+
+			for(uint32_t s = 0; s < SHARDS; ++s) {
+				if(begin[s] == begin[s + 1]) continue;
+				Shard& shard = mShards[s];
+				SolaireSynchronized(shard.lock,
+					beginWrite(shard);
+					growFor(shard, static_cast<int32_t>(begin[s + 1] - begin[s]));
+					for(uint32_t i = begin[s]; i < begin[s + 1]; ++i) {
+						const int32_t index = order[i];
+						emplaceLocked(shard, aEntries[index].first, aEntries[index].second, hashes[index]);
+					}
+					endWrite(shard);
+				);
+			}
+
+			mAllocator.deallocate(order);
+			mAllocator.deallocate(hashes);
+		}
+
+		// Inherited from Map
+
+		/*!
+			\brief Add or replace the value stored with a key.
+			\return A reference to the stored value, which is invalidated by the next write to the same shard.
+			It is not safe to use while other threads are writing to the map.
+		*/
+		T& SOLAIRE_EXPORT_CALL emplace(const K& aKey, const T& aValue) throw() override {
+			const uint64_t hash = hashOf(aKey);
+			Shard& shard = shardOf(hash);
+			SolaireSynchronized(shard.lock,
+				beginWrite(shard);
+				T& value = emplaceLocked(shard, aKey, aValue, hash);
+				endWrite(shard);
+				return value;
+			);
+		}
+
+		/*!
+			\brief Find the value stored with a key, which must be in the map.
+			\return A reference to the stored value, which is invalidated by the next write to the same shard.
+			It is not safe to use while other threads are writing to the map, use tryGet instead.
+			\see tryGet
+		*/
+		const T& SOLAIRE_EXPORT_CALL get(const K& aKey) const throw() override {
+			return const_cast<Self*>(this)->get(aKey);
+		}
+
+		T& SOLAIRE_EXPORT_CALL get(const K& aKey) throw() override {
+			// Lock free reads copy the slot, so the lock is taken to find the address of the stored value
+			const T* value = nullptr;
+			readLocked(aKey, [&value](const T& aStored) {
+				value = &aStored;
+			});
+			// The key must be in the map, there is no value that could be returned otherwise
+			if(value == nullptr) std::terminate();
+			return const_cast<T&>(*value);
+		}
+
+		bool SOLAIRE_EXPORT_CALL contains(const K& aKey) const throw() override {
+			return read(aKey, [](const T&) {});
+		}
+
+		bool SOLAIRE_EXPORT_CALL erase(const K& aKey) throw() override {
+			const uint64_t hash = hashOf(aKey);
+			Shard& shard = shardOf(hash);
+			SolaireSynchronized(shard.lock,
+				Table* const table = shard.table.load(std::memory_order_relaxed);
+				uint32_t slot;
+				if(table == nullptr || ! findSlot(*table, aKey, hash, slot)) return false;
+
+				beginWrite(shard);
+				const uint32_t mask = table->capacity - 1;
+				table->slots[slot].~Slot();
+				uint32_t next = (slot + 1) & mask;
+				while(table->control[next] != Group::EMPTY) {
+					const uint32_t home = homeOf(hashOf(table->slots[next].key), mask);
+					if(((next - home) & mask) >= ((next - slot) & mask)) {
+						if(LOCK_FREE_READS) {
+							storeSlot(*table, slot, table->slots[next]);
+						}else {
+							new(table->slots + slot) Slot(std::move(table->slots[next]));
+							table->slots[next].~Slot();
+						}
+						setControl(*table, slot, table->control[next]);
+						slot = next;
+					}
+					next = (next + 1) & mask;
+				}
+				setControl(*table, slot, Group::EMPTY);
+				shard.size.fetch_sub(1, std::memory_order_relaxed);
+				endWrite(shard);
+				return true;
+			);
+		}
+
+		void SOLAIRE_EXPORT_CALL clear() throw() override {
+			for(Shard& shard : mShards) {
+				SolaireSynchronized(shard.lock,
+					Table* const table = shard.table.load(std::memory_order_relaxed);
+					if(table) {
+						beginWrite(shard);
+						destroySlots(*table);
+						if(LOCK_FREE_READS) {
+							uintptr_t empty;
+							std::memset(&empty, Group::EMPTY, WORD_SIZE);
+							for(uint32_t i = 0; i < controlBytes(table->capacity); i += WORD_SIZE) storeWords(table->control + i, &empty, 1);
+						}else {
+							std::memset(table->control, Group::EMPTY, controlBytes(table->capacity));
+						}
+						shard.size.store(0, std::memory_order_relaxed);
+						endWrite(shard);
+					}
+				);
+			}
+		}
+
+		int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+			int32_t size = 0;
+			for(const Shard& i : mShards) size += i.size.load(std::memory_order_relaxed);
+			return size;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+			return mAllocator;
+		}
+
+		/*!
+			\brief Copy every entry into a new container.
+			\detail The table can be modified by other threads while it is being read, so this is a snapshot rather than a view.
+			Each shard is copied while it is locked, so the entries from one shard are consistent with each other.
+		*/
+		SharedAllocation<StaticContainer<const Entry>> SOLAIRE_EXPORT_CALL getEntries() const throw() override {
+			DynamicArray<Entry> entries(mAllocator, size());
+			forEachLocked([&entries](const Slot& aSlot) {
+				entries.pushBack(Entry(aSlot.key, aSlot.value));
+			});
+			return makeMapView<Implementation::ArrayViewSource<const Entry>>(mAllocator, std::move(entries));
+		}
+
+		/*!
+			\brief Copy every key into a new container.
+			\see getEntries
+		*/
+		SharedAllocation<StaticContainer<const K>> SOLAIRE_EXPORT_CALL getKeys() const throw() override {
+			DynamicArray<K> keys(mAllocator, size());
+			forEachLocked([&keys](const Slot& aSlot) {
+				keys.pushBack(aSlot.key);
+			});
+			return makeMapView<Implementation::ArrayViewSource<const K>>(mAllocator, std::move(keys));
+		}
+
+		/*!
+			\brief Copy every value into a new container.
+			\see getEntries
+		*/
+		SharedAllocation<StaticContainer<const T>> SOLAIRE_EXPORT_CALL getValues() const throw() override {
+			DynamicArray<T> values(mAllocator, size());
+			forEachLocked([&values](const Slot& aSlot) {
+				values.pushBack(aSlot.value);
+			});
+			return makeMapView<Implementation::ArrayViewSource<const T>>(mAllocator, std::move(values));
+		}
+	};
+}
+
+#endif
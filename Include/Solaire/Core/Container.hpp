@@ -31,8 +31,11 @@
 */
 
 #include <cstring>
+#include <type_traits>
 #include "Solaire/Core/Iterator.hpp"
 #include "Solaire/Core/Allocator.hpp"
+#include "Solaire/Core/Simd.hpp"
+#include "Solaire/Core/Span.hpp"
 
 namespace Solaire {
 
@@ -41,10 +44,13 @@ namespace Solaire {
     public:
         template<class T2>
         friend class StaticContainer;
+        template<class T2>
+        friend class STLIterator;
 
         typedef T Type;
         typedef T* Pointer;
         typedef T& Reference;
+        typedef typename std::remove_const<T>::type Element;
     protected:
         virtual Pointer SOLAIRE_EXPORT_CALL getPtr(int32_t) throw() = 0;
         virtual SharedAllocation<Iterator<T>> SOLAIRE_EXPORT_CALL begin_() throw() = 0;
@@ -55,6 +61,39 @@ namespace Solaire {
         SOLAIRE_FORCE_INLINE const Type* getPtr(const int32_t aIndex) const throw() {
             return const_cast<StaticContainer<T>*>(this)->getPtr(aIndex);
         }
+    private:
+        template<class T2>
+        bool equals(const StaticContainer<T2>& aOther) const throw() {
+            const int32_t length = size();
+            if(length != aOther.size()) return false;
+            if(length == 0) return true;
+            if(isContiguous() && aOther.isContiguous()) {
+                return Implementation::findMismatch<Element>(getPtr(0), aOther.getPtr(0), 0, length) == length;
+            }else {
+                for(int32_t i = 0; i < length; ++i) {
+                    if(! (*getPtr(i) == *aOther.getPtr(i))) return false;
+                }
+                return true;
+            }
+        }
+
+        template<class T2>
+        int32_t compareWith(const StaticContainer<T2>& aOther) const throw() {
+            const int32_t length = size();
+            const int32_t otherLength = aOther.size();
+            if(length > 0 && otherLength > 0 && isContiguous() && aOther.isContiguous()) {
+                return Implementation::compareRange<Element>(getPtr(0), length, aOther.getPtr(0), otherLength);
+            }
+
+            const int32_t common = length < otherLength ? length : otherLength;
+            for(int32_t i = 0; i < common; ++i) {
+                const Element& a = *getPtr(i);
+                const Element& b = *aOther.getPtr(i);
+                if(a < b) return -1;
+                if(b < a) return 1;
+            }
+            return length < otherLength ? -1 : length > otherLength ? 1 : 0;
+        }
     public:
         virtual SOLAIRE_EXPORT_CALL ~StaticContainer() throw() {}
 
@@ -71,39 +110,56 @@ namespace Solaire {
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<T> begin() throw() {
-            return STLIterator<T>(begin_());
+            return STLIterator<T>(*this, false, 0);
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<T> end() throw() {
-            return STLIterator<T>(end_());
+            return STLIterator<T>(*this, false, size());
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<const T> begin() const throw() {
             StaticContainer<T>* const p1 = const_cast<StaticContainer<T>*>(this);
             StaticContainer<const T>* const p2 = reinterpret_cast<StaticContainer<const T>*>(p1);
-            return STLIterator<const T>(p2->begin_());
+            return STLIterator<const T>(*p2, false, 0);
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<const T> end() const throw() {
             StaticContainer<T>* const p1 = const_cast<StaticContainer<T>*>(this);
             StaticContainer<const T>* const p2 = reinterpret_cast<StaticContainer<const T>*>(p1);
-            return STLIterator<const T>(p2->end_());
+            return STLIterator<const T>(*p2, false, size());
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<T> rbegin() throw() {
-            return STLIterator<T>(rbegin_());
+            return STLIterator<T>(*this, true, 0);
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<T> rend() throw() {
-            return STLIterator<T>(rend_());
+            return STLIterator<T>(*this, true, size());
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<const T> rbegin() const throw() {
-            return STLIterator<T>(const_cast<StaticContainer<T>*>(this)->rbegin_());
+            StaticContainer<T>* const p1 = const_cast<StaticContainer<T>*>(this);
+            StaticContainer<const T>* const p2 = reinterpret_cast<StaticContainer<const T>*>(p1);
+            return STLIterator<const T>(*p2, true, 0);
         }
 
         SOLAIRE_FORCE_INLINE STLIterator<const T> rend() const throw() {
-            return STLIterator<T>(const_cast<StaticContainer<T>*>(this)->rend_());
+            StaticContainer<T>* const p1 = const_cast<StaticContainer<T>*>(this);
+            StaticContainer<const T>* const p2 = reinterpret_cast<StaticContainer<const T>*>(p1);
+            return STLIterator<const T>(*p2, true, size());
+        }
+
+        /*!
+            \brief Get the elements as a Span.
+            \return The elements, or an empty span if the container is not contiguous.
+        */
+        SOLAIRE_FORCE_INLINE Span<T> getSpan() throw() {
+            const int32_t length = size();
+            return length > 0 && isContiguous() ? Span<T>(getPtr(0), length) : Span<T>();
+        }
+
+        SOLAIRE_FORCE_INLINE Span<const T> getSpan() const throw() {
+            return const_cast<StaticContainer<T>*>(this)->getSpan();
         }
 
         SOLAIRE_FORCE_INLINE operator StaticContainer<const T>&() throw() {
@@ -114,30 +170,33 @@ namespace Solaire {
             return *reinterpret_cast<const StaticContainer<const T>*>(this);
         }
 
-        inline bool operator==(const StaticContainer<const T>& aOther) const throw() {
-            const int32_t length = size();
-            if(length != aOther.size()) return false;
-            if(std::is_fundamental<T>::value && isContiguous() && aOther.isContiguous()) {
-                return std::memcmp(getPtr(0), aOther.getPtr(0), sizeof(T) * length) == 0;
-            }else {
-                for(int32_t i = 0; i < length; ++i) {
-                    if(getPtr(i) != aOther.getPtr(i)) return false;
-                }
-                return true;
-            }
+        SOLAIRE_FORCE_INLINE bool operator==(const StaticContainer<Element>& aOther) const throw() {
+            return equals(aOther);
         }
 
-        inline bool operator!=(const StaticContainer<const T>& aOther) const throw() {
-            const int32_t length = size();
-            if(length != aOther.size()) return true;
-            if(std::is_fundamental<T>::value && isContiguous() && aOther.isContiguous()) {
-                return std::memcmp(getPtr(0), aOther.getPtr(0), sizeof(T) * length) != 0;
-            }else {
-                for(int32_t i = 0; i < length; ++i) {
-                    if(getPtr(i) != aOther.getPtr(i)) return true;
-                }
-                return false;
-            }
+        SOLAIRE_FORCE_INLINE bool operator==(const StaticContainer<const Element>& aOther) const throw() {
+            return equals(aOther);
+        }
+
+        SOLAIRE_FORCE_INLINE bool operator!=(const StaticContainer<Element>& aOther) const throw() {
+            return ! equals(aOther);
+        }
+
+        SOLAIRE_FORCE_INLINE bool operator!=(const StaticContainer<const Element>& aOther) const throw() {
+            return ! equals(aOther);
+        }
+
+        /*!
+            \brief Lexicographically compare the elements with those of another container.
+            \detail Elements are ordered with operator<, if neither element is less than the other they are treated as equivalent.
+            \return A negative value if this container orders first, 0 if they are equivalent or a positive value if \a aOther orders first.
+        */
+        SOLAIRE_FORCE_INLINE int32_t compare(const StaticContainer<Element>& aOther) const throw() {
+            return compareWith(aOther);
+        }
+
+        SOLAIRE_FORCE_INLINE int32_t compare(const StaticContainer<const Element>& aOther) const throw() {
+            return compareWith(aOther);
         }
 
         SOLAIRE_FORCE_INLINE int32_t findFirstOf(const T& aValue) const throw() {
@@ -147,30 +206,32 @@ namespace Solaire {
         inline int32_t findNextOf(const int32_t aIndex, const T& aValue) const throw() {
             const int32_t length = size();
             if(isContiguous()) {
-                const T* const ptr = const_cast<StaticContainer<T>*>(this)->getPtr(0);
-                for(int32_t i = aIndex; i < length; ++i) {
-                    if(ptr[i] == aValue) return i;
-                }
+                if(length == 0) return 0;
+                return Implementation::searchForward(getPtr(0), aIndex, length, aValue);
             }else {
                 for(int32_t i = aIndex; i < length; ++i) {
-                    if(*const_cast<StaticContainer<T>*>(this)->getPtr(i) == aValue) return i;
+                    if(*getPtr(i) == aValue) return i;
                 }
             }
 
             return length;
         }
 
+        /*!
+            \return The index of the last match, or size() if there is none.
+        */
         inline int32_t findLastOf(const T& aValue) const throw() {
-            const int32_t end = size();
-            int32_t i = findFirstOf(aValue);
-            int32_t j = i;
-
-            while(i != end) {
-                j = i;
-                i = findNextOf(i + 1, aValue);
+            const int32_t length = size();
+            if(isContiguous()) {
+                if(length == 0) return 0;
+                return Implementation::searchBackward(getPtr(0), 0, length, aValue);
+            }else {
+                for(int32_t i = length - 1; i >= 0; --i) {
+                    if(*getPtr(i) == aValue) return i;
+                }
             }
 
-            return j;
+            return length;
         }
 
         template<class F>
@@ -197,19 +258,95 @@ namespace Solaire {
 
         template<class F>
         inline int32_t findLastIf(const F aCondition) const throw() {
-            const int32_t end = size();
-            int32_t i = findFirstIf(aCondition);
-            int32_t j = i;
-
-            while(i != end) {
-                j = i;
-                i = findNextIf(i + 1, aCondition);
+            const int32_t length = size();
+            if(isContiguous()) {
+                const T* const ptr = const_cast<StaticContainer<T>*>(this)->getPtr(0);
+                for(int32_t i = length - 1; i >= 0; --i) {
+                    if(aCondition(ptr[i])) return i;
+                }
+            }else {
+                for(int32_t i = length - 1; i >= 0; --i) {
+                    if(aCondition(*const_cast<StaticContainer<T>*>(this)->getPtr(i))) return i;
+                }
             }
 
-            return j;
+            return length;
         }
 	};
 
+    /*!
+        \class ContiguousView
+        \brief A StaticContainer over the elements of a Span.
+        \detail This is how a Span is passed to code that expects a StaticContainer, it does not own the elements.
+        Iterators are allocated with the default allocator.
+        \author Adam Smith
+        \date Created : 17th October 2026
+        \date Modified : 17th October 2026
+        \version 1.0
+        \see Span
+    */
+    template<class T>
+    class ContiguousView : public StaticContainer<T> {
+    public:
+        typedef T Type;
+        typedef T* Pointer;
+        typedef ContiguousView<T> Self;
+    private:
+        Span<T> mSpan;
+    protected:
+        // Inherited from StaticContainer
+
+        Pointer SOLAIRE_EXPORT_CALL getPtr(int32_t aIndex) throw() override {
+            return mSpan.data() + aIndex;
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL begin_() throw() override {
+            Allocator& allocator = getDefaultAllocator();
+            return makeSharedAs<Iterator<Type>, ContiguousIterator<Type>>(allocator, allocator, mSpan.data(), 0);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL end_() throw() override {
+            Allocator& allocator = getDefaultAllocator();
+            return makeSharedAs<Iterator<Type>, ContiguousIterator<Type>>(allocator, allocator, mSpan.data(), mSpan.size());
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rbegin_() throw() override {
+            Allocator& allocator = getDefaultAllocator();
+            return makeSharedAs<Iterator<Type>, ReverseContiguousIterator<Type>>(allocator, allocator, mSpan.data() + mSpan.size() - 1, 0);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rend_() throw() override {
+            Allocator& allocator = getDefaultAllocator();
+            return makeSharedAs<Iterator<Type>, ReverseContiguousIterator<Type>>(allocator, allocator, mSpan.data() + mSpan.size() - 1, mSpan.size());
+        }
+    public:
+        ContiguousView(const Span<T> aSpan) throw() :
+            mSpan(aSpan)
+        {}
+
+        ContiguousView(T* const aData, const int32_t aSize) throw() :
+            mSpan(aData, aSize)
+        {}
+
+        SOLAIRE_EXPORT_CALL ~ContiguousView() throw() {
+
+        }
+
+        // Inherited from StaticContainer
+
+        bool SOLAIRE_EXPORT_CALL isContiguous() const throw() override {
+            return true;
+        }
+
+        int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+            return mSpan.size();
+        }
+
+        Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+            return getDefaultAllocator();
+        }
+    };
+
 	template<class T>
 	SOLAIRE_EXPORT_INTERFACE Stack : public StaticContainer<T> {
 	public:
@@ -219,11 +356,11 @@ namespace Solaire {
 		virtual void SOLAIRE_EXPORT_CALL clear() throw() = 0;
 
 		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL back() throw() {
-			return StaticContainer<T>::operator[](StaticContainer<T>::size() - 1);
+			return StaticContainer<T>::operator[](this->size() - 1);
 		}
 
 		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL back() const throw() {
-			return StaticContainer<T>::operator[](StaticContainer<T>::size() - 1);
+			return StaticContainer<T>::operator[](this->size() - 1);
 		}
 
         SOLAIRE_FORCE_INLINE operator Stack<const T>&() throw() {
@@ -297,7 +434,24 @@ namespace Solaire {
 		virtual void SOLAIRE_EXPORT_CALL clear() throw() = 0;
         virtual int32_t SOLAIRE_EXPORT_CALL size() const throw() = 0;
         virtual Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() = 0;
-        virtual SharedAllocation<StaticContainer<Entry>> getEntries() const throw() = 0;
+
+        /*!
+            \brief Get every entry in the map.
+            \detail Implementations return a view of their own storage where they can, so the view is invalidated by any modification of the map.
+        */
+        virtual SharedAllocation<StaticContainer<const Entry>> SOLAIRE_EXPORT_CALL getEntries() const throw() = 0;
+
+        /*!
+            \brief Get every key in the map, in the same order as getEntries.
+            \detail The keys are read from the map as they are accessed.
+        */
+        virtual SharedAllocation<StaticContainer<const K>> SOLAIRE_EXPORT_CALL getKeys() const throw() = 0;
+
+        /*!
+            \brief Get every value in the map, in the same order as getEntries.
+            \detail The values are read from the map as they are accessed.
+        */
+        virtual SharedAllocation<StaticContainer<const T>> SOLAIRE_EXPORT_CALL getValues() const throw() = 0;
 
         SOLAIRE_FORCE_INLINE T& operator[](const K& aKey) throw() {
             return this->get(aKey);
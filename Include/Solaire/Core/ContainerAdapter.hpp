@@ -0,0 +1,269 @@
+#ifndef SOLAIRE_CONTAINER_ADAPTER_HPP
+#define SOLAIRE_CONTAINER_ADAPTER_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ContainerAdapter.hpp
+	\brief Adapters that expose an InlineContainer through the virtual container interfaces.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include "Solaire/Core/Container.hpp"
+#include "Solaire/Core/InlineContainer.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		template<class C, class BASE>
+		class VirtualContainerBase : public BASE {
+		public:
+			typedef typename C::Type Type;
+			typedef Type* Pointer;
+		private:
+			class AdapterIterator : public Iterator<Type> {
+			private:
+				C& mContainer;
+				int32_t mOffset;
+				bool mReverse;
+			public:
+				AdapterIterator(C& aContainer, const int32_t aOffset, const bool aReverse) throw() :
+					mContainer(aContainer),
+					mOffset(aOffset),
+					mReverse(aReverse)
+				{}
+
+				SOLAIRE_EXPORT_CALL ~AdapterIterator() throw() {
+
+				}
+
+				// Inherited from Iterator
+
+				Iterator<Type>& SOLAIRE_EXPORT_CALL increment(const int32_t aCount) throw() override {
+					mOffset += aCount;
+					return *this;
+				}
+
+				Iterator<Type>& SOLAIRE_EXPORT_CALL decrement(const int32_t aCount) throw() override {
+					mOffset -= aCount;
+					return *this;
+				}
+
+				SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL copy() const throw() override {
+					return makeSharedAs<Iterator<Type>, AdapterIterator>(getDefaultAllocator(), mContainer, mOffset, mReverse);
+				}
+
+				int32_t SOLAIRE_EXPORT_CALL getOffset() const throw() override {
+					return mOffset;
+				}
+
+				Type* SOLAIRE_EXPORT_CALL getPtr() throw() override {
+					return mContainer.getPtr(mReverse ? mContainer.size() - 1 - mOffset : mOffset);
+				}
+			};
+		protected:
+			C& mContainer;
+		protected:
+			// Inherited from StaticContainer
+
+			Pointer SOLAIRE_EXPORT_CALL getPtr(int32_t aIndex) throw() override {
+				return mContainer.getPtr(aIndex);
+			}
+
+			SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL begin_() throw() override {
+				return makeSharedAs<Iterator<Type>, AdapterIterator>(getDefaultAllocator(), mContainer, 0, false);
+			}
+
+			SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL end_() throw() override {
+				return makeSharedAs<Iterator<Type>, AdapterIterator>(getDefaultAllocator(), mContainer, mContainer.size(), false);
+			}
+
+			SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rbegin_() throw() override {
+				return makeSharedAs<Iterator<Type>, AdapterIterator>(getDefaultAllocator(), mContainer, 0, true);
+			}
+
+			SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rend_() throw() override {
+				return makeSharedAs<Iterator<Type>, AdapterIterator>(getDefaultAllocator(), mContainer, mContainer.size(), true);
+			}
+		public:
+			VirtualContainerBase(C& aContainer) throw() :
+				mContainer(aContainer)
+			{}
+
+			SOLAIRE_EXPORT_CALL ~VirtualContainerBase() throw() {
+
+			}
+
+			// Inherited from StaticContainer
+
+			bool SOLAIRE_EXPORT_CALL isContiguous() const throw() override {
+				return mContainer.isContiguous();
+			}
+
+			int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+				return mContainer.size();
+			}
+
+			Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+				return getDefaultAllocator();
+			}
+		};
+
+		template<class C, class BASE>
+		class VirtualStackBase : public VirtualContainerBase<C, BASE> {
+		public:
+			typedef typename C::Type Type;
+		public:
+			VirtualStackBase(C& aContainer) throw() :
+				VirtualContainerBase<C, BASE>(aContainer)
+			{}
+
+			// Inherited from Stack
+
+			Type& SOLAIRE_EXPORT_CALL pushBack(const Type& aValue) throw() override {
+				return this->mContainer.pushBack(aValue);
+			}
+
+			Type SOLAIRE_EXPORT_CALL popBack() throw() override {
+				return this->mContainer.popBack();
+			}
+
+			void SOLAIRE_EXPORT_CALL clear() throw() override {
+				this->mContainer.clear();
+			}
+		};
+
+		template<class C, class BASE>
+		class VirtualDequeBase : public VirtualStackBase<C, BASE> {
+		public:
+			typedef typename C::Type Type;
+		public:
+			VirtualDequeBase(C& aContainer) throw() :
+				VirtualStackBase<C, BASE>(aContainer)
+			{}
+
+			// Inherited from Deque
+
+			Type& SOLAIRE_EXPORT_CALL pushFront(const Type& aValue) throw() override {
+				return this->mContainer.pushFront(aValue);
+			}
+
+			Type SOLAIRE_EXPORT_CALL popFront() throw() override {
+				return this->mContainer.popFront();
+			}
+		};
+	}
+
+	/*!
+		\class VirtualContainer
+		\brief Exposes an InlineContainer as a StaticContainer so that it can be passed across a module boundary.
+		\detail The adapter refers to the container rather than copying it, so it must not outlive it.
+		Iterators are allocated with the default allocator.
+		\tparam C The type of container, which is usually derived from InlineContainer.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see InlineContainer
+	*/
+	template<class C>
+	class VirtualContainer : public Implementation::VirtualContainerBase<C, StaticContainer<typename C::Type>> {
+	public:
+		VirtualContainer(C& aContainer) throw() :
+			Implementation::VirtualContainerBase<C, StaticContainer<typename C::Type>>(aContainer)
+		{}
+	};
+
+	/*!
+		\class VirtualStack
+		\brief Exposes an InlineStack as a Stack.
+		\detail C must provide pushBack, popBack and clear with the same signatures as Stack.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see InlineStack
+	*/
+	template<class C>
+	class VirtualStack : public Implementation::VirtualStackBase<C, Stack<typename C::Type>> {
+	public:
+		VirtualStack(C& aContainer) throw() :
+			Implementation::VirtualStackBase<C, Stack<typename C::Type>>(aContainer)
+		{}
+	};
+
+	/*!
+		\class VirtualDeque
+		\brief Exposes an InlineDeque as a Deque.
+		\detail C must also provide pushFront and popFront with the same signatures as Deque.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see InlineDeque
+	*/
+	template<class C>
+	class VirtualDeque : public Implementation::VirtualDequeBase<C, Deque<typename C::Type>> {
+	public:
+		VirtualDeque(C& aContainer) throw() :
+			Implementation::VirtualDequeBase<C, Deque<typename C::Type>>(aContainer)
+		{}
+	};
+
+	/*!
+		\class VirtualList
+		\brief Exposes an InlineList as a List.
+		\detail C must also provide insertBefore, insertAfter and erase with the same signatures as List.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see InlineList
+	*/
+	template<class C>
+	class VirtualList : public Implementation::VirtualDequeBase<C, List<typename C::Type>> {
+	public:
+		typedef typename C::Type Type;
+	public:
+		VirtualList(C& aContainer) throw() :
+			Implementation::VirtualDequeBase<C, List<Type>>(aContainer)
+		{}
+
+		// Inherited from List
+
+		Type& SOLAIRE_EXPORT_CALL insertBefore(const int32_t aIndex, const Type& aValue) throw() override {
+			return this->mContainer.insertBefore(aIndex, aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL insertAfter(const int32_t aIndex, const Type& aValue) throw() override {
+			return this->mContainer.insertAfter(aIndex, aValue);
+		}
+
+		bool SOLAIRE_EXPORT_CALL erase(const int32_t aIndex) throw() override {
+			return this->mContainer.erase(aIndex);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,365 @@
+#ifndef SOLAIRE_DYNAMIC_ARRAY_HPP
+#define SOLAIRE_DYNAMIC_ARRAY_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file DynamicArray.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include "Solaire/Core/Container.hpp"
+
+namespace Solaire {
+
+    namespace Implementation {
+        /*!
+            \brief Move \a aCount objects to uninitialised memory, the source objects are destroyed.
+            \detail The ranges must not overlap.
+        */
+        template<class T>
+        static void relocate(T* const aDst, T* const aSrc, const int32_t aCount) throw() {
+            if(std::is_trivially_copyable<T>::value) {
+                if(aCount > 0) std::memcpy(static_cast<void*>(aDst), static_cast<const void*>(aSrc), sizeof(T) * aCount);
+            }else {
+                for(int32_t i = 0; i < aCount; ++i) {
+                    new(aDst + i) T(std::move(aSrc[i]));
+                    aSrc[i].~T();
+                }
+            }
+        }
+
+        template<class T>
+        static void destroyRange(T* const aBegin, const int32_t aCount) throw() {
+            if(! std::is_trivially_destructible<T>::value) {
+                for(int32_t i = 0; i < aCount; ++i) aBegin[i].~T();
+            }
+        }
+    }
+
+    /*!
+        \class DynamicArray
+        \brief A List that stores its elements in a single block of memory.
+        \detail The capacity grows geometrically so pushBack is amortised O(1).
+        Trivially copyable elements are relocated with memcpy, or resized in place by the Allocator where possible.
+        \tparam T The type of element to store.
+        \author Adam Smith
+        \date Created : 17th October 2026
+        \date Modified : 17th October 2026
+        \version 1.0
+    */
+    template<class T>
+	class DynamicArray : public List<T> {
+	public:
+		typedef T Type;
+		typedef const T ConstType;
+		typedef Type& Reference;
+		typedef ConstType& ConstReference;
+		typedef Type* Pointer;
+		typedef ConstType* ConstPointer;
+		typedef DynamicArray<T> Self;
+	private:
+	    enum : int32_t {
+	        MIN_CAPACITY = 8,
+	        MAX_CAPACITY = INT32_MAX / 2
+	    };
+	private:
+	    Allocator& mAllocator;
+	    Pointer mData;
+	    int32_t mSize;
+	    int32_t mCapacity;
+    private:
+        static constexpr bool canReallocate() throw() {
+            return std::is_trivially_copyable<T>::value && alignof(T) <= static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT);
+        }
+
+        Pointer allocateElements(const int32_t aCount) throw() {
+            const size_t bytes = sizeof(T) * static_cast<size_t>(aCount);
+            return static_cast<Pointer>(alignof(T) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+                mAllocator.allocateAligned(bytes, alignof(T)) :
+                mAllocator.allocate(bytes)
+            );
+        }
+
+        bool setCapacity(const int32_t aCapacity) throw() {
+            if(aCapacity == mCapacity) return true;
+            if(aCapacity < mSize) return false;
+
+            if(aCapacity == 0) {
+                mAllocator.deallocate(mData);
+                mData = nullptr;
+                mCapacity = 0;
+                return true;
+            }
+
+            if(canReallocate()) {
+                // The allocator may be able to resize the block without copying
+                Pointer const data = static_cast<Pointer>(mAllocator.reallocate(mData, sizeof(T) * static_cast<size_t>(aCapacity)));
+                if(data == nullptr) return false;
+                mData = data;
+            }else {
+                Pointer const data = allocateElements(aCapacity);
+                if(data == nullptr) return false;
+                if(mData) {
+                    Implementation::relocate<T>(data, mData, mSize);
+                    mAllocator.deallocate(mData);
+                }
+                mData = data;
+            }
+
+            mCapacity = aCapacity;
+            return true;
+        }
+
+        void growFor(const int32_t aCount) throw() {
+            const int32_t required = mSize + aCount;
+            if(required <= mCapacity) return;
+            int32_t capacity = mCapacity < MIN_CAPACITY ? MIN_CAPACITY : mCapacity;
+            while(capacity < required && capacity <= MAX_CAPACITY) capacity *= 2;
+            if(capacity < required) capacity = required;
+            // There is no way to report a failed insertion through the List interface
+            if(! setCapacity(capacity)) std::terminate();
+        }
+
+        bool isElement(const T& aValue) const throw() {
+            const ConstPointer ptr = &aValue;
+            return ptr >= mData && ptr < mData + mSize;
+        }
+    protected:
+        // Inherited from StaticContainer
+
+        Pointer SOLAIRE_EXPORT_CALL getPtr(int32_t aIndex) throw() override {
+            return mData + aIndex;
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL begin_() throw() override {
+            return makeSharedAs<Iterator<Type>, ContiguousIterator<Type>>(mAllocator, mAllocator, mData, 0);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL end_() throw() override {
+            return makeSharedAs<Iterator<Type>, ContiguousIterator<Type>>(mAllocator, mAllocator, mData, mSize);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rbegin_() throw() override {
+            return makeSharedAs<Iterator<Type>, ReverseContiguousIterator<Type>>(mAllocator, mAllocator, mData + mSize - 1, 0);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rend_() throw() override {
+            return makeSharedAs<Iterator<Type>, ReverseContiguousIterator<Type>>(mAllocator, mAllocator, mData + mSize - 1, mSize);
+        }
+    public:
+        DynamicArray() throw() :
+            mAllocator(getDefaultAllocator()),
+            mData(nullptr),
+            mSize(0),
+            mCapacity(0)
+        {}
+
+        DynamicArray(Allocator& aAllocator) throw() :
+            mAllocator(aAllocator),
+            mData(nullptr),
+            mSize(0),
+            mCapacity(0)
+        {}
+
+        DynamicArray(Allocator& aAllocator, const int32_t aCapacity) throw() :
+            mAllocator(aAllocator),
+            mData(nullptr),
+            mSize(0),
+            mCapacity(0)
+        {
+            reserve(aCapacity);
+        }
+
+        DynamicArray(const Self& aOther) throw() :
+            mAllocator(aOther.mAllocator),
+            mData(nullptr),
+            mSize(0),
+            mCapacity(0)
+        {
+            operator=(aOther);
+        }
+
+        DynamicArray(Self&& aOther) throw() :
+            mAllocator(aOther.mAllocator),
+            mData(aOther.mData),
+            mSize(aOther.mSize),
+            mCapacity(aOther.mCapacity)
+        {
+            aOther.mData = nullptr;
+            aOther.mSize = 0;
+            aOther.mCapacity = 0;
+        }
+
+        SOLAIRE_EXPORT_CALL ~DynamicArray() throw() {
+            clear();
+            if(mData) mAllocator.deallocate(mData);
+        }
+
+        Self& operator=(const Self& aOther) throw() {
+            if(&aOther == this) return *this;
+            clear();
+            growFor(aOther.mSize);
+            if(std::is_trivially_copyable<T>::value) {
+                if(aOther.mSize > 0) std::memcpy(static_cast<void*>(mData), static_cast<const void*>(aOther.mData), sizeof(T) * aOther.mSize);
+            }else {
+                for(int32_t i = 0; i < aOther.mSize; ++i) new(mData + i) T(aOther.mData[i]);
+            }
+            mSize = aOther.mSize;
+            return *this;
+        }
+
+        Self& operator=(Self&& aOther) throw() {
+            if(&mAllocator != &aOther.mAllocator) return operator=(static_cast<const Self&>(aOther));
+            std::swap(mData, aOther.mData);
+            std::swap(mSize, aOther.mSize);
+            std::swap(mCapacity, aOther.mCapacity);
+            return *this;
+        }
+
+        /*!
+            \brief Make sure that at least \a aCapacity elements can be stored without reallocating.
+            \return False if the memory could not be allocated.
+        */
+        bool reserve(const int32_t aCapacity) throw() {
+            return aCapacity <= mCapacity ? true : setCapacity(aCapacity);
+        }
+
+        /*!
+            \brief Release any capacity that is not being used by an element.
+            \return False if the memory could not be reallocated.
+        */
+        bool shrinkToFit() throw() {
+            return setCapacity(mSize);
+        }
+
+        int32_t capacity() const throw() {
+            return mCapacity;
+        }
+
+        Pointer data() throw() {
+            return mData;
+        }
+
+        ConstPointer data() const throw() {
+            return mData;
+        }
+
+        // Inherited from StaticContainer
+
+        bool SOLAIRE_EXPORT_CALL isContiguous() const throw() override {
+            return true;
+        }
+
+        int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+            return mSize;
+        }
+
+        Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+            return mAllocator;
+        }
+
+        // Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL pushBack(const Type& aValue) throw() override {
+		    if(mSize == mCapacity && isElement(aValue)) {
+                // Growing would invalidate aValue
+                Type tmp(aValue);
+                growFor(1);
+                new(mData + mSize) Type(std::move(tmp));
+		    }else {
+                growFor(1);
+                new(mData + mSize) Type(aValue);
+		    }
+		    return mData[mSize++];
+        }
+
+		Type SOLAIRE_EXPORT_CALL popBack() throw() override {
+		    --mSize;
+		    Type tmp(std::move(mData[mSize]));
+		    mData[mSize].~Type();
+		    return tmp;
+		}
+
+		void SOLAIRE_EXPORT_CALL clear() throw() override {
+            Implementation::destroyRange<T>(mData, mSize);
+            mSize = 0;
+        }
+
+        // Inherited from Deque
+
+		Type& SOLAIRE_EXPORT_CALL pushFront(const Type& aValue) throw() override {
+		    return insertBefore(0, aValue);
+		}
+
+		Type SOLAIRE_EXPORT_CALL popFront() throw() override {
+		    Type tmp(std::move(mData[0]));
+		    erase(0);
+		    return tmp;
+		}
+
+		// Inherited from List
+
+		Type& SOLAIRE_EXPORT_CALL insertBefore(const int32_t aIndex, const Type& aValue) throw() override {
+		    if(aIndex >= mSize) return pushBack(aValue);
+
+		    Type tmp(aValue);
+		    growFor(1);
+		    if(std::is_trivially_copyable<T>::value) {
+                std::memmove(static_cast<void*>(mData + aIndex + 1), static_cast<const void*>(mData + aIndex), sizeof(T) * (mSize - aIndex));
+                new(mData + aIndex) Type(std::move(tmp));
+		    }else {
+                new(mData + mSize) Type(std::move(mData[mSize - 1]));
+                std::move_backward(mData + aIndex, mData + mSize - 1, mData + mSize);
+                mData[aIndex] = std::move(tmp);
+		    }
+		    ++mSize;
+		    return mData[aIndex];
+		}
+
+		Type& SOLAIRE_EXPORT_CALL insertAfter(const int32_t aIndex, const Type& aValue) throw() override {
+            return insertBefore(aIndex + 1, aValue);
+		}
+
+		bool SOLAIRE_EXPORT_CALL erase(const int32_t aIndex) throw() override {
+		    if(aIndex < 0 || aIndex >= mSize) return false;
+		    if(std::is_trivially_copyable<T>::value) {
+                std::memmove(static_cast<void*>(mData + aIndex), static_cast<const void*>(mData + aIndex + 1), sizeof(T) * (mSize - aIndex - 1));
+		    }else {
+                std::move(mData + aIndex + 1, mData + mSize, mData + aIndex);
+                mData[mSize - 1].~Type();
+		    }
+		    --mSize;
+		    return true;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,364 @@
+#ifndef SOLAIRE_EPOCH_MANAGER_HPP
+#define SOLAIRE_EPOCH_MANAGER_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file EpochManager.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <new>
+#include "Init.hpp"
+#include "AllocatorI.hpp"
+#include "UniqueAllocation.hpp"
+
+namespace Solaire {
+
+	class EpochManager;
+
+	/*!
+		\class EpochReader
+		\brief A reader thread's registration with an EpochManager.
+		\detail Objects retired while a reader is inside an epoch are not reclaimed until it has left.
+		A reader must only be used by one thread at a time.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see EpochManager
+	*/
+	class EpochReader {
+	public:
+		friend class EpochManager;
+	private:
+		enum : uint64_t {
+			ACTIVE = 1
+		};
+		enum : uint32_t {
+			CACHE_LINE_SIZE = 64
+		};
+	private:
+		// Epochs are stored shifted left by one, the low bit is set while the reader is active
+		std::atomic<uint64_t> mState;
+		std::atomic<bool> mRegistered;
+		std::atomic<uint64_t>& mGlobalEpoch;
+		EpochReader* mNext;
+		uint32_t mDepth;
+		uint8_t mPadding[CACHE_LINE_SIZE];
+	private:
+		EpochReader(std::atomic<uint64_t>& aGlobalEpoch) throw() :
+			mState(0),
+			mRegistered(true),
+			mGlobalEpoch(aGlobalEpoch),
+			mNext(nullptr),
+			mDepth(0)
+		{}
+	public:
+		/*!
+			\brief Enter the current epoch.
+			\detail Pointers to retired objects that are loaded after this call remain valid until exit is called.
+			Calls can be nested, only the outermost pair has any effect.
+		*/
+		void enter() throw() {
+			if(mDepth++ != 0) return;
+			mState.store((mGlobalEpoch.load(std::memory_order_relaxed) << 1) | ACTIVE, std::memory_order_relaxed);
+			// The announcement must be visible before any shared pointers are loaded
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+		}
+
+		/*!
+			\brief Leave the epoch entered by the matching call to enter.
+		*/
+		void exit() throw() {
+			if(--mDepth != 0) return;
+			mState.store(0, std::memory_order_release);
+		}
+
+		bool isActive() const throw() {
+			return mDepth != 0;
+		}
+	};
+
+	/*!
+		\class EpochGuard
+		\brief Keeps an EpochReader inside an epoch for the lifetime of the guard.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+	*/
+	class EpochGuard {
+	private:
+		EpochReader& mReader;
+	private:
+		EpochGuard(const EpochGuard&) = delete;
+		EpochGuard& operator=(const EpochGuard&) = delete;
+	public:
+		EpochGuard(EpochReader& aReader) throw() :
+			mReader(aReader)
+		{
+			mReader.enter();
+		}
+
+		~EpochGuard() throw() {
+			mReader.exit();
+		}
+	};
+
+	/*!
+		\class EpochManager
+		\brief Defers the destruction of shared objects until no reader can observe them.
+		\detail Readers announce the epoch they are in with a single store, no shared counters are modified.
+		A writer that replaces a shared object retires the old one, which is then destroyed and returned to
+		its own allocator once every reader that could have loaded it has left its epoch.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see EpochReader
+	*/
+	class EpochManager {
+	private:
+		typedef void (SOLAIRE_EXPORT_CALL *Destructor)(void* const);
+
+		struct Retired {
+			Retired* next;
+			void* object;
+			Destructor destructor;
+			AllocatorI* allocator;
+			uint64_t epoch;
+		};
+
+		enum : uint32_t {
+			// Attempt to advance the epoch after this many objects have been retired
+			COLLECT_THRESHOLD = 64
+		};
+	private:
+		std::atomic<uint64_t> mGlobalEpoch;
+		AllocatorI& mAllocator;
+		std::mutex mLock;
+		EpochReader* mReaders;
+		Retired* mRetiredHead;
+		Retired* mRetiredTail;
+		// Written under mLock, but read without it by getRetiredCount
+		std::atomic<uint32_t> mRetiredCount;
+		uint32_t mSinceCollect;
+	private:
+		template<class T>
+		static void SOLAIRE_EXPORT_CALL destroyObject(void* const aObject) throw() {
+			static_cast<T*>(aObject)->~T();
+		}
+
+		bool tryAdvance() throw() {
+			const uint64_t epoch = mGlobalEpoch.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			for(EpochReader* i = mReaders; i != nullptr; i = i->mNext) {
+				const uint64_t state = i->mState.load(std::memory_order_acquire);
+				if((state & EpochReader::ACTIVE) && (state >> 1) != epoch) return false;
+			}
+			mGlobalEpoch.store(epoch + 1, std::memory_order_seq_cst);
+			return true;
+		}
+
+		uint32_t reclaim() throw() {
+			// Readers in epoch N may still hold objects retired in N - 1, so only epochs before that are safe
+			const uint64_t epoch = mGlobalEpoch.load(std::memory_order_relaxed);
+			uint32_t count = 0;
+			while(mRetiredHead != nullptr && mRetiredHead->epoch + 2 <= epoch) {
+				Retired* const retired = mRetiredHead;
+				mRetiredHead = retired->next;
+				retired->destructor(retired->object);
+				retired->allocator->deallocate(retired->object);
+				mAllocator.deallocate(retired);
+				++count;
+			}
+			if(mRetiredHead == nullptr) mRetiredTail = nullptr;
+			mRetiredCount.fetch_sub(count, std::memory_order_relaxed);
+			return count;
+		}
+
+		uint32_t collectLocked() throw() {
+			mSinceCollect = 0;
+			tryAdvance();
+			return reclaim();
+		}
+
+		bool retireObject(AllocatorI& aAllocator, void* const aObject, const Destructor aDestructor) throw() {
+			if(aObject == nullptr) return false;
+			Retired* const retired = static_cast<Retired*>(mAllocator.allocate(sizeof(Retired)));
+			if(retired == nullptr) {
+				// The retirement can't be recorded, so wait until no reader can observe the object instead
+				synchronize();
+				aDestructor(aObject);
+				aAllocator.deallocate(aObject);
+				return true;
+			}
+
+			retired->next = nullptr;
+			retired->object = aObject;
+			retired->destructor = aDestructor;
+			retired->allocator = &aAllocator;
+
+			SolaireSynchronized(mLock,
+				// The object must have been unlinked before the epoch is read
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				retired->epoch = mGlobalEpoch.load(std::memory_order_relaxed);
+				if(mRetiredTail) mRetiredTail->next = retired;
+				else mRetiredHead = retired;
+				mRetiredTail = retired;
+				mRetiredCount.fetch_add(1, std::memory_order_relaxed);
+				if(++mSinceCollect >= COLLECT_THRESHOLD) collectLocked();
+			);
+			return true;
+		}
+
+		EpochManager(const EpochManager&) = delete;
+		EpochManager& operator=(const EpochManager&) = delete;
+	public:
+		EpochManager(AllocatorI& aAllocator) throw() :
+			mGlobalEpoch(0),
+			mAllocator(aAllocator),
+			mReaders(nullptr),
+			mRetiredHead(nullptr),
+			mRetiredTail(nullptr),
+			mRetiredCount(0),
+			mSinceCollect(0)
+		{}
+
+		/*!
+			\brief Destroy the manager and every object that is still waiting to be reclaimed.
+			\detail No reader may be inside an epoch when the manager is destroyed.
+		*/
+		~EpochManager() throw() {
+			mGlobalEpoch.fetch_add(2, std::memory_order_relaxed);
+			reclaim();
+			EpochReader* i = mReaders;
+			while(i != nullptr) {
+				EpochReader* const next = i->mNext;
+				i->~EpochReader();
+				mAllocator.deallocate(i);
+				i = next;
+			}
+		}
+
+		/*!
+			\brief Register a reader, reusing one that has been released if possible.
+			\return The reader, or nullptr if the allocation failed.
+			\see releaseReader
+		*/
+		EpochReader* acquireReader() throw() {
+			SolaireSynchronized(mLock,
+				for(EpochReader* i = mReaders; i != nullptr; i = i->mNext) {
+					bool expected = false;
+					if(i->mRegistered.compare_exchange_strong(expected, true, std::memory_order_acquire)) return i;
+				}
+			);
+
+			// Aligning to a cache line only avoids false sharing, so accept any block from allocators that can't align this far
+			void* block = mAllocator.allocateAligned(sizeof(EpochReader), EpochReader::CACHE_LINE_SIZE);
+			if(block == nullptr) block = mAllocator.allocate(sizeof(EpochReader));
+			if(block == nullptr) return nullptr;
+			EpochReader* const reader = new(block) EpochReader(mGlobalEpoch);
+			SolaireSynchronized(mLock,
+				reader->mNext = mReaders;
+				mReaders = reader;
+			);
+			return reader;
+		}
+
+		/*!
+			\brief Return a reader to the manager so that it can be used by another thread.
+			\param aReader The reader, which must not be inside an epoch.
+			\return False if the reader is still inside an epoch.
+		*/
+		bool releaseReader(EpochReader& aReader) throw() {
+			if(aReader.isActive()) return false;
+			aReader.mRegistered.store(false, std::memory_order_release);
+			return true;
+		}
+
+		/*!
+			\brief Destroy an object once no reader can observe it.
+			\detail The object must already be unreachable from the shared structure that readers traverse.
+			\param aAllocator The allocator that the object will be returned to.
+			\param aObject The object to retire.
+			\return False if the object was null.
+		*/
+		template<class T>
+		bool retire(AllocatorI& aAllocator, T* const aObject) throw() {
+			return retireObject(aAllocator, const_cast<void*>(static_cast<const void*>(aObject)), &destroyObject<T>);
+		}
+
+		template<class T>
+		bool retire(UniqueAllocation<T>&& aObject) throw() {
+			AllocatorI& allocator = aObject.getAllocator();
+			T* const object = aObject.releaseOwnership();
+			return retire<T>(allocator, object);
+		}
+
+		/*!
+			\brief Attempt to advance the epoch and reclaim any objects that are no longer observable.
+			\return The number of objects that were reclaimed.
+		*/
+		uint32_t collect() throw() {
+			SolaireSynchronized(mLock,
+				return collectLocked();
+			);
+		}
+
+		/*!
+			\brief Block until every object that has already been retired can be reclaimed.
+			\detail The calling thread must not be inside an epoch.
+		*/
+		void synchronize() throw() {
+			const uint64_t target = mGlobalEpoch.load(std::memory_order_relaxed) + 2;
+			while(mGlobalEpoch.load(std::memory_order_relaxed) < target) {
+				SolaireSynchronized(mLock,
+					tryAdvance();
+				);
+				std::this_thread::yield();
+			}
+			collect();
+		}
+
+		uint64_t getEpoch() const throw() {
+			return mGlobalEpoch.load(std::memory_order_relaxed);
+		}
+
+		/*!
+			\return The number of objects waiting to be reclaimed, which may already be out of date if other threads are active.
+		*/
+		uint32_t getRetiredCount() const throw() {
+			return mRetiredCount.load(std::memory_order_relaxed);
+		}
+	};
+}
+
+#endif
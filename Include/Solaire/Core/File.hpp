@@ -28,13 +28,13 @@
 	\version 1.0
 	\date
 	Created			: 20th November 2015
-	Last Modified	: 15th January 2016
+	Last Modified	: 17th October 2026
 */
 
 #include <cstdint>
-#include "Solaire\Core\Maths.hpp"
-#include "Solaire\Core\Container.hpp"
-#include "Solaire\Core\STLString.hpp"
+#include "Solaire/Core/Maths.hpp"
+#include "Solaire/Core/Container.hpp"
+#include "Solaire/Core/STLString.hpp"
 
 namespace Solaire {
     namespace FileImplementation {
@@ -92,8 +92,10 @@ namespace Solaire {
 
 #if SOLAIRE_OS == SOLAIRE_WINDOWS
     #include "Solaire/Core/FileWindows.inl"
+#elif SOLAIRE_OS == SOLAIRE_LINUX
+    #include "Solaire/Core/FilePosix.inl"
 #else
-    #error SolaireCpp : File I/O only implemented for windows
+    #error SolaireCpp : File I/O only implemented for windows and linux
 #endif
 
 #endif
@@ -0,0 +1,293 @@
+#ifndef SOLAIRE_FILE_INL
+#define SOLAIRE_FILE_INL
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file FilePosix.inl
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+namespace Solaire { namespace FileImplementation {
+
+    namespace Implementation {
+
+        enum {
+            COPY_BUFFER_SIZE = 4096
+        };
+
+        /*!
+            \brief Copy a path into a null terminated buffer of MAX_PATH_LENGTH + 1 characters.
+            \return The buffer, or nullptr if the path is too long to fit.
+        */
+        static const char* const makeCString(const StringConstant<char>& aString, char* aPath) {
+            const int32_t size = aString.size();
+            if(size < 0 || size > MAX_PATH_LENGTH) return nullptr;
+            aPath[size] = '\0';
+            if(aString.isContiguous()) {
+                std::memcpy(aPath, &aString[0], size);
+            }else {
+                for(int32_t i = 0; i < size; ++i) aPath[i] = aString[i];
+            }
+            return aPath;
+        }
+
+        static bool writeAll(const int aFile, const char* aData, ssize_t aBytes) {
+            while(aBytes > 0) {
+                const ssize_t written = ::write(aFile, aData, aBytes);
+                if(written < 0) {
+                    if(errno == EINTR) continue;
+                    return false;
+                }
+                aData += written;
+                aBytes -= written;
+            }
+            return true;
+        }
+
+        static bool copyFile(const char* const aSrc, const char* const aDst) {
+            const int src = ::open(aSrc, O_RDONLY);
+            if(src < 0) return false;
+
+            struct stat info;
+            if(::fstat(src, &info) != 0) {
+                ::close(src);
+                return false;
+            }
+
+            const int dst = ::open(aDst, O_WRONLY | O_CREAT | O_TRUNC, info.st_mode & 0777);
+            if(dst < 0) {
+                ::close(src);
+                return false;
+            }
+
+            char buffer[COPY_BUFFER_SIZE];
+            bool result = true;
+            while(result) {
+                const ssize_t bytes = ::read(src, buffer, COPY_BUFFER_SIZE);
+                if(bytes == 0) break;
+                if(bytes < 0) {
+                    if(errno == EINTR) continue;
+                    result = false;
+                }else {
+                    result = writeAll(dst, buffer, bytes);
+                }
+            }
+
+            ::close(src);
+            if(::close(dst) != 0) result = false;
+            return result;
+        }
+
+        static int32_t findNameBegin(const StringConstant<char>& aFilename) {
+            const int32_t seperator = aFilename.findLastOf(FILE_SEPERATOR);
+            return seperator == aFilename.size() ? 0 : seperator + 1;
+        }
+    }
+
+    AttributeFlags SOLAIRE_EXPORT_CALL getAttributes(const StringConstant<char>& aFilename) throw() {
+        char buffer[MAX_PATH_LENGTH + 1];
+        const char* const filename = Implementation::makeCString(aFilename, buffer);
+        if(filename == nullptr) return FLAG_NONE;
+
+        struct stat info;
+        if(::stat(filename, &info) != 0) return FLAG_NONE;
+
+        AttributeFlags tmp = FLAG_EXISTS;
+        if(S_ISDIR(info.st_mode)) tmp |= FLAG_DIRECTORY;
+        else tmp |= FLAG_FILE;
+        if(::access(filename, R_OK) == 0) tmp |= FLAG_READ;
+        if(::access(filename, W_OK) == 0) tmp |= FLAG_WRITE;
+        if(! S_ISDIR(info.st_mode) && ::access(filename, X_OK) == 0) tmp |= FLAG_EXECUTABLE;
+        const int32_t nameBegin = Implementation::findNameBegin(aFilename);
+        if(nameBegin < aFilename.size() && aFilename[nameBegin] == '.') tmp |= FLAG_HIDDEN;
+
+        return tmp;
+    }
+
+    bool SOLAIRE_EXPORT_CALL createFile(const StringConstant<char>& aFilename, const AttributeFlags aAttributes) throw() {
+        //! \todo FLAG_HIDDEN is determined by the file name on POSIX systems and cannot be set here
+        char buffer[MAX_PATH_LENGTH + 1];
+        const char* const filename = Implementation::makeCString(aFilename, buffer);
+        if(filename == nullptr) return false;
+
+        mode_t mode = 0;
+        if(aAttributes & FLAG_READ) mode |= S_IRUSR | S_IRGRP | S_IROTH;
+        if(aAttributes & FLAG_WRITE) mode |= S_IWUSR;
+        if(aAttributes & FLAG_EXECUTABLE) mode |= S_IXUSR | S_IXGRP | S_IXOTH;
+
+        const int file = ::open(filename, O_WRONLY | O_CREAT | O_EXCL, mode);
+
+        if(file >= 0) {
+            ::close(file);
+            return true;
+        }else {
+            return false;
+        }
+    }
+
+    bool SOLAIRE_EXPORT_CALL createDirectory(const StringConstant<char>& aFilename) throw() {
+        char buffer[MAX_PATH_LENGTH + 1];
+        const char* const filename = Implementation::makeCString(aFilename, buffer);
+        return filename != nullptr && ::mkdir(filename, S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) == 0;
+    }
+
+    bool SOLAIRE_EXPORT_CALL deleteFile(const StringConstant<char>& aFilename) throw() {
+        char buffer[MAX_PATH_LENGTH + 1];
+        const char* const filename = Implementation::makeCString(aFilename, buffer);
+        return filename != nullptr && ::unlink(filename) == 0;
+    }
+
+    bool SOLAIRE_EXPORT_CALL deleteDirectory(const StringConstant<char>& aFilename) throw() {
+        char buffer[MAX_PATH_LENGTH + 1];
+        const char* const filename = Implementation::makeCString(aFilename, buffer);
+        return filename != nullptr && ::rmdir(filename) == 0;
+    }
+
+    STLString SOLAIRE_EXPORT_CALL getParent(const StringConstant<char>& aFilename) throw() {
+        const int32_t length = aFilename.size();
+        const int32_t seperator = aFilename.findLastOf(FILE_SEPERATOR);
+
+        STLString path;
+        if(seperator != length) for(int32_t i = 0; i <= seperator; ++i) path.pushBack(aFilename[i]);
+        return path;
+    }
+
+    STLString SOLAIRE_EXPORT_CALL getName(const StringConstant<char>& aFilename) throw() {
+        const int32_t begin = Implementation::findNameBegin(aFilename);
+        int32_t end = aFilename.findLastOf('.');
+        if(end < begin) end = aFilename.size();
+
+        STLString tmp;
+        for(int32_t i = begin; i < end; ++i) tmp.pushBack(aFilename[i]);
+        return tmp;
+    }
+
+    STLString SOLAIRE_EXPORT_CALL getExtension(const StringConstant<char>& aFilename) throw() {
+        const int32_t length = aFilename.size();
+        const int32_t begin = Implementation::findNameBegin(aFilename);
+        const int32_t seperator = aFilename.findLastOf('.');
+
+        if(seperator == length || seperator < begin) {
+            return STLString();
+        }else {
+            STLString tmp;
+            for(int32_t i = seperator + 1; i < length; ++i) tmp.pushBack(aFilename[i]);
+            return tmp;
+        }
+    }
+
+    int32_t SOLAIRE_EXPORT_CALL size(const StringConstant<char>& aFilename) throw() {
+        char buffer[MAX_PATH_LENGTH + 1];
+        const char* const filename = Implementation::makeCString(aFilename, buffer);
+        if(filename == nullptr) return 0;
+
+        struct stat info;
+        if(::stat(filename, &info) != 0) return 0;
+        return static_cast<int32_t>(info.st_size);
+    }
+
+    bool SOLAIRE_EXPORT_CALL getFileList(const StringConstant<char>& aDirectory, Stack<STLString>& aFiles) throw() {
+        char buffer[MAX_PATH_LENGTH + 1];
+        const char* const directory = Implementation::makeCString(aDirectory, buffer);
+        if(directory == nullptr) return false;
+
+        DIR* const handle = ::opendir(directory);
+        if(handle == nullptr) return false;
+
+        const dirent* entry;
+        while((entry = ::readdir(handle)) != nullptr) {
+            const char* const name = entry->d_name;
+            if(name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) continue;
+            aFiles.pushBack(STLString(std::string(name)));
+        }
+
+        ::closedir(handle);
+
+        return true;
+    }
+
+    STLString SOLAIRE_EXPORT_CALL getCurrentDirectory() throw() {
+        char buffer[MAX_PATH_LENGTH + 1];
+        const bool tmp = ::getcwd(buffer, MAX_PATH_LENGTH) != nullptr;
+        return tmp ? STLString(std::string(buffer)) : STLString();
+    }
+
+    STLString SOLAIRE_EXPORT_CALL getTemporaryDirectory() throw() {
+        const char* directory = std::getenv("TMPDIR");
+        if(directory == nullptr || directory[0] == '\0') directory = P_tmpdir;
+
+        std::string tmp(directory);
+        if(tmp.back() != FILE_SEPERATOR) tmp += FILE_SEPERATOR;
+        return STLString(tmp);
+    }
+
+    bool SOLAIRE_EXPORT_CALL rename(const StringConstant<char>& aOldName, const StringConstant<char>& aNewName) throw() {
+        char bufferA[MAX_PATH_LENGTH + 1];
+        char bufferB[MAX_PATH_LENGTH + 1];
+        const char* const oldName = Implementation::makeCString(aOldName, bufferA);
+        const char* const newName = Implementation::makeCString(aNewName, bufferB);
+        return oldName != nullptr && newName != nullptr && ::rename(oldName, newName) == 0;
+    }
+
+    bool SOLAIRE_EXPORT_CALL copy(const StringConstant<char>& aSrc, const StringConstant<char>& aDst) throw() {
+        char bufferA[MAX_PATH_LENGTH + 1];
+        char bufferB[MAX_PATH_LENGTH + 1];
+        const char* const src = Implementation::makeCString(aSrc, bufferA);
+        const char* const dst = Implementation::makeCString(aDst, bufferB);
+        return src != nullptr && dst != nullptr && Implementation::copyFile(src, dst);
+    }
+
+    bool SOLAIRE_EXPORT_CALL move(const StringConstant<char>& aFilename, const StringConstant<char>& aTarget) throw() {
+        char bufferA[MAX_PATH_LENGTH + 1];
+        char bufferB[MAX_PATH_LENGTH + 1];
+        const char* const src = Implementation::makeCString(aFilename, bufferA);
+        const char* const dst = Implementation::makeCString(aTarget, bufferB);
+        if(src == nullptr || dst == nullptr) return false;
+
+        if(::rename(src, dst) == 0) return true;
+
+        // rename cannot cross file systems, fall back to a copy
+        if(errno != EXDEV) return false;
+        if(! Implementation::copyFile(src, dst)) return false;
+        if(::unlink(src) != 0) {
+            ::unlink(dst);
+            return false;
+        }
+        return true;
+    }
+}}
+
+#endif
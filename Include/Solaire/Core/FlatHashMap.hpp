@@ -0,0 +1,508 @@
+#ifndef SOLAIRE_FLAT_HASH_MAP_HPP
+#define SOLAIRE_FLAT_HASH_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file FlatHashMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <utility>
+#include "Solaire/Core/MapView.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define SOLAIRE_FLAT_HASH_SSE2
+	#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+namespace Solaire {
+
+	namespace Implementation {
+		/*!
+			\brief Scans the control bytes of a FlatHashMap 16 slots at a time.
+			\detail Full slots store the low 7 bits of their hash, empty slots store EMPTY.
+		*/
+		class HashGroup {
+		public:
+			enum : uint32_t {
+				WIDTH = 16
+			};
+
+			enum : uint8_t {
+				EMPTY = 0x80
+			};
+		private:
+			#ifdef SOLAIRE_FLAT_HASH_SSE2
+				__m128i mControl;
+			#else
+				const uint8_t* mControl;
+			#endif
+		public:
+			SOLAIRE_FORCE_INLINE HashGroup(const uint8_t* const aControl) throw() :
+				#ifdef SOLAIRE_FLAT_HASH_SSE2
+					mControl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aControl)))
+				#else
+					mControl(aControl)
+				#endif
+			{}
+
+			#ifdef SOLAIRE_FLAT_HASH_SSE2
+				/*!
+					\brief Build a group from control bytes that have already been loaded.
+					\detail The low byte of \a aLow is the control byte of the first slot.
+				*/
+				SOLAIRE_FORCE_INLINE HashGroup(const uint64_t aLow, const uint64_t aHigh) throw() :
+					mControl(_mm_set_epi64x(static_cast<long long>(aHigh), static_cast<long long>(aLow)))
+				{}
+			#endif
+
+			/*!
+				\brief Find the slots whose control byte equals \a aByte.
+				\return A mask with bit N set if slot N matches.
+			*/
+			SOLAIRE_FORCE_INLINE uint32_t match(const uint8_t aByte) const throw() {
+				#ifdef SOLAIRE_FLAT_HASH_SSE2
+					return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(mControl, _mm_set1_epi8(static_cast<char>(aByte)))));
+				#else
+					uint32_t mask = 0;
+					for(uint32_t i = 0; i < WIDTH; ++i) if(mControl[i] == aByte) mask |= 1u << i;
+					return mask;
+				#endif
+			}
+
+			SOLAIRE_FORCE_INLINE uint32_t matchEmpty() const throw() {
+				return match(EMPTY);
+			}
+
+			static SOLAIRE_FORCE_INLINE uint32_t lowestBit(const uint32_t aMask) throw() {
+				#ifdef _MSC_VER
+					unsigned long index;
+					_BitScanForward(&index, aMask);
+					return static_cast<uint32_t>(index);
+				#else
+					return static_cast<uint32_t>(__builtin_ctz(aMask));
+				#endif
+			}
+		};
+	}
+
+	/*!
+		\class FlatHashMap
+		\brief A Map that stores its entries in a single open addressed table.
+		\detail Slots are found by linear probing, with the control bytes of 16 slots compared at once.
+		Erasing shifts the following entries back instead of leaving tombstones, so lookups never slow down as entries are removed.
+		\tparam K The key type.
+		\tparam T The value type.
+		\tparam HASH The hash function for \a K.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+	*/
+	template<class K, class T, class HASH = std::hash<K>>
+	class FlatHashMap : public Map<K, T> {
+	public:
+		typedef typename Map<K, T>::Entry Entry;
+		typedef FlatHashMap<K, T, HASH> Self;
+	private:
+		typedef Implementation::HashGroup Group;
+
+		enum : uint32_t {
+			MIN_CAPACITY = Group::WIDTH,
+			MAX_CAPACITY = 1u << 30
+		};
+
+		/*
+			Views the full slots in table order.
+			The position of the last access is cached so that a sequential scan skips each empty slot once.
+		*/
+		class SlotSource {
+		public:
+			typedef const Entry Type;
+		private:
+			const Entry* mSlots;
+			const uint8_t* mControl;
+			uint32_t mCapacity;
+			int32_t mSize;
+			uint32_t mSlot;
+			int32_t mIndex;
+		private:
+			uint32_t nextFull(uint32_t aSlot) const throw() {
+				for(; aSlot < mCapacity; aSlot += Group::WIDTH) {
+					const uint32_t full = ~Group(mControl + aSlot).matchEmpty() & ((1u << Group::WIDTH) - 1);
+					if(full != 0) {
+						// Matches past the end of the table are the mirrored control bytes
+						aSlot += Group::lowestBit(full);
+						return aSlot < mCapacity ? aSlot : mCapacity;
+					}
+				}
+				return mCapacity;
+			}
+
+			uint32_t previousFull(uint32_t aSlot) const throw() {
+				while(mControl[aSlot] == Group::EMPTY) --aSlot;
+				return aSlot;
+			}
+		public:
+			SlotSource(const Self& aMap) throw() :
+				mSlots(aMap.mSlots),
+				mControl(aMap.mControl),
+				mCapacity(aMap.mCapacity),
+				mSize(aMap.mSize),
+				mSlot(0),
+				mIndex(0)
+			{
+				mSlot = nextFull(0);
+			}
+
+			const Entry* getPtr(const int32_t aIndex) throw() {
+				if(aIndex < mIndex && aIndex < mIndex - aIndex) {
+					// Walking forwards from the first slot is shorter than walking backwards
+					mSlot = nextFull(0);
+					mIndex = 0;
+				}
+				for(; mIndex < aIndex; ++mIndex) mSlot = nextFull(mSlot + 1);
+				for(; mIndex > aIndex; --mIndex) mSlot = previousFull(mSlot - 1);
+				return mSlots + mSlot;
+			}
+
+			SOLAIRE_FORCE_INLINE int32_t size() const throw() {
+				return mSize;
+			}
+
+			SOLAIRE_FORCE_INLINE bool isContiguous() const throw() {
+				return false;
+			}
+		};
+	private:
+		Allocator& mAllocator;
+		Entry* mSlots;
+		uint8_t* mControl;
+		uint32_t mCapacity;
+		int32_t mSize;
+		HASH mHash;
+	private:
+		SOLAIRE_FORCE_INLINE uint64_t hashOf(const K& aKey) const throw() {
+			// Mix the hash so that identity hashes still spread over the table and the control bytes
+			uint64_t hash = static_cast<uint64_t>(mHash(aKey)) * 0x9E3779B97F4A7C15ull;
+			return hash ^ (hash >> 29);
+		}
+
+		static SOLAIRE_FORCE_INLINE uint8_t controlOf(const uint64_t aHash) throw() {
+			return static_cast<uint8_t>(aHash & 0x7F);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t homeOf(const uint64_t aHash) const throw() {
+			return static_cast<uint32_t>(aHash >> 7) & (mCapacity - 1);
+		}
+
+		SOLAIRE_FORCE_INLINE void setControl(const uint32_t aSlot, const uint8_t aByte) throw() {
+			mControl[aSlot] = aByte;
+			// The first slots are mirrored after the end so that a group can be loaded from any slot without wrapping
+			if(aSlot < Group::WIDTH - 1) mControl[mCapacity + aSlot] = aByte;
+		}
+
+		/*!
+			\brief Find the slot that holds \a aKey, or the empty slot that it would be inserted into.
+			\return True if the key was found.
+		*/
+		bool findSlot(const K& aKey, const uint64_t aHash, uint32_t& aSlot) const throw() {
+			if(mCapacity == 0) return false;
+			const uint8_t control = controlOf(aHash);
+			const uint32_t mask = mCapacity - 1;
+			uint32_t pos = homeOf(aHash);
+			while(true) {
+				const Group group(mControl + pos);
+				const uint32_t empty = group.matchEmpty();
+				// Slots after the first empty one belong to other probe sequences
+				const uint32_t limit = empty == 0 ? 0xFFFFFFFF : (1u << Group::lowestBit(empty)) - 1;
+				uint32_t matches = group.match(control) & limit;
+				while(matches != 0) {
+					const uint32_t slot = (pos + Group::lowestBit(matches)) & mask;
+					if(mSlots[slot].first == aKey) {
+						aSlot = slot;
+						return true;
+					}
+					matches &= matches - 1;
+				}
+				if(empty != 0) {
+					aSlot = (pos + Group::lowestBit(empty)) & mask;
+					return false;
+				}
+				pos = (pos + Group::WIDTH) & mask;
+			}
+		}
+
+		bool allocateTable(const uint32_t aCapacity) throw() {
+			const size_t slotBytes = sizeof(Entry) * static_cast<size_t>(aCapacity);
+			const size_t bytes = slotBytes + aCapacity + Group::WIDTH;
+			uint8_t* const block = static_cast<uint8_t*>(alignof(Entry) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+				mAllocator.allocateAligned(bytes, alignof(Entry)) :
+				mAllocator.allocate(bytes)
+			);
+			if(block == nullptr) return false;
+
+			mSlots = reinterpret_cast<Entry*>(block);
+			mControl = block + slotBytes;
+			mCapacity = aCapacity;
+			std::memset(mControl, Group::EMPTY, aCapacity + Group::WIDTH);
+			return true;
+		}
+
+		bool rehash(const uint32_t aCapacity) throw() {
+			Entry* const oldSlots = mSlots;
+			const uint8_t* const oldControl = mControl;
+			const uint32_t oldCapacity = mCapacity;
+
+			if(! allocateTable(aCapacity)) return false;
+
+			for(uint32_t i = 0; i < oldCapacity; ++i) {
+				if(oldControl[i] == Group::EMPTY) continue;
+				const uint64_t hash = hashOf(oldSlots[i].first);
+				uint32_t slot;
+				findSlot(oldSlots[i].first, hash, slot);
+				setControl(slot, controlOf(hash));
+				new(mSlots + slot) Entry(std::move(oldSlots[i]));
+				oldSlots[i].~Entry();
+			}
+
+			if(oldSlots) mAllocator.deallocate(oldSlots);
+			return true;
+		}
+
+		void growFor(const int32_t aCount) throw() {
+			const uint64_t required = static_cast<uint64_t>(mSize + aCount);
+			// Keep the load factor at or below 7/8 so that every probe sequence ends at an empty slot
+			if(required * 8 <= static_cast<uint64_t>(mCapacity) * 7) return;
+			uint32_t capacity = mCapacity < MIN_CAPACITY ? static_cast<uint32_t>(MIN_CAPACITY) : mCapacity;
+			while(required * 8 > static_cast<uint64_t>(capacity) * 7) {
+				if(capacity >= MAX_CAPACITY) std::terminate();
+				capacity *= 2;
+			}
+			// There is no way to report a failed insertion through the Map interface
+			if(! rehash(capacity)) std::terminate();
+		}
+
+		void eraseSlot(uint32_t aSlot) throw() {
+			const uint32_t mask = mCapacity - 1;
+			mSlots[aSlot].~Entry();
+
+			// Shift the following entries back until one is found that is already in its home slot
+			uint32_t next = (aSlot + 1) & mask;
+			while(mControl[next] != Group::EMPTY) {
+				const uint32_t home = homeOf(hashOf(mSlots[next].first));
+				if(((next - home) & mask) >= ((next - aSlot) & mask)) {
+					new(mSlots + aSlot) Entry(std::move(mSlots[next]));
+					mSlots[next].~Entry();
+					setControl(aSlot, mControl[next]);
+					aSlot = next;
+				}
+				next = (next + 1) & mask;
+			}
+
+			setControl(aSlot, Group::EMPTY);
+			--mSize;
+		}
+
+		void destroyEntries() throw() {
+			if(! std::is_trivially_destructible<Entry>::value) {
+				for(uint32_t i = 0; i < mCapacity; ++i) {
+					if(mControl[i] != Group::EMPTY) mSlots[i].~Entry();
+				}
+			}
+		}
+	public:
+		FlatHashMap() throw() :
+			mAllocator(getDefaultAllocator()),
+			mSlots(nullptr),
+			mControl(nullptr),
+			mCapacity(0),
+			mSize(0),
+			mHash()
+		{}
+
+		FlatHashMap(Allocator& aAllocator) throw() :
+			mAllocator(aAllocator),
+			mSlots(nullptr),
+			mControl(nullptr),
+			mCapacity(0),
+			mSize(0),
+			mHash()
+		{}
+
+		FlatHashMap(const Self& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mSlots(nullptr),
+			mControl(nullptr),
+			mCapacity(0),
+			mSize(0),
+			mHash(aOther.mHash)
+		{
+			operator=(aOther);
+		}
+
+		FlatHashMap(Self&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mSlots(aOther.mSlots),
+			mControl(aOther.mControl),
+			mCapacity(aOther.mCapacity),
+			mSize(aOther.mSize),
+			mHash(aOther.mHash)
+		{
+			aOther.mSlots = nullptr;
+			aOther.mControl = nullptr;
+			aOther.mCapacity = 0;
+			aOther.mSize = 0;
+		}
+
+		SOLAIRE_EXPORT_CALL ~FlatHashMap() throw() {
+			destroyEntries();
+			if(mSlots) mAllocator.deallocate(mSlots);
+		}
+
+		Self& operator=(const Self& aOther) throw() {
+			if(&aOther == this) return *this;
+			clear();
+			growFor(aOther.mSize);
+			for(uint32_t i = 0; i < aOther.mCapacity; ++i) {
+				if(aOther.mControl[i] != Group::EMPTY) emplace(aOther.mSlots[i].first, aOther.mSlots[i].second);
+			}
+			return *this;
+		}
+
+		Self& operator=(Self&& aOther) throw() {
+			if(&mAllocator != &aOther.mAllocator) return operator=(static_cast<const Self&>(aOther));
+			std::swap(mSlots, aOther.mSlots);
+			std::swap(mControl, aOther.mControl);
+			std::swap(mCapacity, aOther.mCapacity);
+			std::swap(mSize, aOther.mSize);
+			std::swap(mHash, aOther.mHash);
+			return *this;
+		}
+
+		/*!
+			\brief Make sure that at least \a aCount entries can be stored without rehashing.
+		*/
+		void reserve(const int32_t aCount) throw() {
+			if(aCount > mSize) growFor(aCount - mSize);
+		}
+
+		int32_t capacity() const throw() {
+			return static_cast<int32_t>(mCapacity);
+		}
+
+		/*!
+			\brief Find the value stored with a key.
+			\return The address of the value, or nullptr if the key is not in the map.
+		*/
+		T* find(const K& aKey) throw() {
+			uint32_t slot;
+			return findSlot(aKey, hashOf(aKey), slot) ? &mSlots[slot].second : nullptr;
+		}
+
+		const T* find(const K& aKey) const throw() {
+			return const_cast<Self*>(this)->find(aKey);
+		}
+
+		// Inherited from Map
+
+		T& SOLAIRE_EXPORT_CALL emplace(const K& aKey, const T& aValue) throw() override {
+			const uint64_t hash = hashOf(aKey);
+			uint32_t slot;
+			if(findSlot(aKey, hash, slot)) {
+				mSlots[slot].second = aValue;
+				return mSlots[slot].second;
+			}
+
+			if(static_cast<uint64_t>(mSize + 1) * 8 > static_cast<uint64_t>(mCapacity) * 7) {
+				growFor(1);
+				findSlot(aKey, hash, slot);
+			}
+			new(mSlots + slot) Entry(aKey, aValue);
+			setControl(slot, controlOf(hash));
+			++mSize;
+			return mSlots[slot].second;
+		}
+
+		const T& SOLAIRE_EXPORT_CALL get(const K& aKey) const throw() override {
+			return const_cast<Self*>(this)->get(aKey);
+		}
+
+		T& SOLAIRE_EXPORT_CALL get(const K& aKey) throw() override {
+			T* const value = find(aKey);
+			// The key must be in the map, there is no value that could be returned otherwise
+			if(value == nullptr) std::terminate();
+			return *value;
+		}
+
+		bool SOLAIRE_EXPORT_CALL contains(const K& aKey) const throw() override {
+			return find(aKey) != nullptr;
+		}
+
+		bool SOLAIRE_EXPORT_CALL erase(const K& aKey) throw() override {
+			uint32_t slot;
+			if(! findSlot(aKey, hashOf(aKey), slot)) return false;
+			eraseSlot(slot);
+			return true;
+		}
+
+		void SOLAIRE_EXPORT_CALL clear() throw() override {
+			if(mCapacity == 0) return;
+			destroyEntries();
+			std::memset(mControl, Group::EMPTY, mCapacity + Group::WIDTH);
+			mSize = 0;
+		}
+
+		int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+			return mSize;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+			return mAllocator;
+		}
+
+		SharedAllocation<StaticContainer<const Entry>> SOLAIRE_EXPORT_CALL getEntries() const throw() override {
+			return makeMapView<SlotSource>(mAllocator, *this);
+		}
+
+		SharedAllocation<StaticContainer<const K>> SOLAIRE_EXPORT_CALL getKeys() const throw() override {
+			return makeMapView<Implementation::EntryKeySource<SlotSource>>(mAllocator, *this);
+		}
+
+		SharedAllocation<StaticContainer<const T>> SOLAIRE_EXPORT_CALL getValues() const throw() override {
+			return makeMapView<Implementation::EntryValueSource<SlotSource>>(mAllocator, *this);
+		}
+	};
+}
+
+#endif
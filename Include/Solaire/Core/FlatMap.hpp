@@ -0,0 +1,244 @@
+#ifndef SOLAIRE_FLAT_MAP_HPP
+#define SOLAIRE_FLAT_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file FlatMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <functional>
+#include "Solaire/Core/MapView.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		/*!
+			\brief Find the first index in [0, aCount) for which \a aLess returns false.
+			\detail The loop has a fixed trip count for a given \a aCount and the step is selected without a branch.
+			\param aCount The number of elements to search.
+			\param aLess Returns true if the element at an index is ordered before the value being searched for.
+			\return The index, or aCount if every element is less.
+		*/
+		template<class F>
+		static inline uint32_t branchlessLowerBound(uint32_t aCount, const F& aLess) throw() {
+			if(aCount == 0) return 0;
+			uint32_t base = 0;
+			while(aCount > 1) {
+				const uint32_t half = aCount / 2;
+				base = aLess(base + half) ? base + half : base;
+				aCount -= half;
+			}
+			return base + (aLess(base) ? 1 : 0);
+		}
+	}
+
+	/*!
+		\class FlatMap
+		\brief A Map that keeps its entries sorted by key in a single contiguous array.
+		\detail Lookups are a branchless binary search and range scans walk adjacent memory.
+		Insertion and erasure are O(n), so this suits maps that are read far more often than they are modified.
+		\tparam K The key type.
+		\tparam T The value type.
+		\tparam COMPARE The ordering of \a K.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see BTreeMap
+	*/
+	template<class K, class T, class COMPARE = std::less<K>>
+	class FlatMap : public Map<K, T> {
+	public:
+		typedef typename Map<K, T>::Entry Entry;
+		typedef FlatMap<K, T, COMPARE> Self;
+	private:
+		typedef Implementation::ContiguousViewSource<const Entry> EntrySource;
+	private:
+		DynamicArray<Entry> mEntries;
+		COMPARE mCompare;
+	public:
+		FlatMap() throw() :
+			mEntries(),
+			mCompare()
+		{}
+
+		FlatMap(Allocator& aAllocator) throw() :
+			mEntries(aAllocator),
+			mCompare()
+		{}
+
+		FlatMap(const Self& aOther) throw() :
+			mEntries(aOther.mEntries),
+			mCompare(aOther.mCompare)
+		{}
+
+		FlatMap(Self&& aOther) throw() :
+			mEntries(std::move(aOther.mEntries)),
+			mCompare(aOther.mCompare)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~FlatMap() throw() {
+
+		}
+
+		Self& operator=(const Self& aOther) throw() {
+			mEntries = aOther.mEntries;
+			mCompare = aOther.mCompare;
+			return *this;
+		}
+
+		Self& operator=(Self&& aOther) throw() {
+			mEntries = std::move(aOther.mEntries);
+			mCompare = aOther.mCompare;
+			return *this;
+		}
+
+		bool reserve(const int32_t aCount) throw() {
+			return mEntries.reserve(aCount);
+		}
+
+		bool shrinkToFit() throw() {
+			return mEntries.shrinkToFit();
+		}
+
+		/*!
+			\brief Find the first entry whose key is not ordered before \a aKey.
+			\return The index of the entry, or size() if there is no such entry.
+		*/
+		int32_t lowerBound(const K& aKey) const throw() {
+			const Entry* const entries = mEntries.data();
+			const COMPARE& compare = mCompare;
+			return static_cast<int32_t>(Implementation::branchlessLowerBound(static_cast<uint32_t>(mEntries.size()), [entries, &compare, &aKey](const uint32_t aIndex) {
+				return compare(entries[aIndex].first, aKey);
+			}));
+		}
+
+		/*!
+			\brief Find the first entry whose key is ordered after \a aKey.
+			\return The index of the entry, or size() if there is no such entry.
+		*/
+		int32_t upperBound(const K& aKey) const throw() {
+			const Entry* const entries = mEntries.data();
+			const COMPARE& compare = mCompare;
+			return static_cast<int32_t>(Implementation::branchlessLowerBound(static_cast<uint32_t>(mEntries.size()), [entries, &compare, &aKey](const uint32_t aIndex) {
+				return ! compare(aKey, entries[aIndex].first);
+			}));
+		}
+
+		Entry& getEntry(const int32_t aIndex) throw() {
+			return mEntries[aIndex];
+		}
+
+		const Entry& getEntry(const int32_t aIndex) const throw() {
+			return mEntries[aIndex];
+		}
+
+		/*!
+			\brief Call \a aFunction with every entry whose key is in [aBegin, aEnd).
+			\param aFunction Called in key order with (const K&, T&).
+			\return The number of entries that were visited.
+		*/
+		template<class F>
+		int32_t forEachInRange(const K& aBegin, const K& aEnd, F aFunction) throw() {
+			const int32_t size = mEntries.size();
+			int32_t i = lowerBound(aBegin);
+			const int32_t begin = i;
+			for(; i < size && mCompare(mEntries[i].first, aEnd); ++i) {
+				Entry& entry = mEntries[i];
+				aFunction(const_cast<const K&>(entry.first), entry.second);
+			}
+			return i - begin;
+		}
+
+		T* find(const K& aKey) throw() {
+			const int32_t i = lowerBound(aKey);
+			return i < mEntries.size() && ! mCompare(aKey, mEntries[i].first) ? &mEntries[i].second : nullptr;
+		}
+
+		const T* find(const K& aKey) const throw() {
+			return const_cast<Self*>(this)->find(aKey);
+		}
+
+		// Inherited from Map
+
+		T& SOLAIRE_EXPORT_CALL emplace(const K& aKey, const T& aValue) throw() override {
+			const int32_t i = lowerBound(aKey);
+			if(i < mEntries.size() && ! mCompare(aKey, mEntries[i].first)) {
+				mEntries[i].second = aValue;
+				return mEntries[i].second;
+			}
+			return mEntries.insertBefore(i, Entry(aKey, aValue)).second;
+		}
+
+		const T& SOLAIRE_EXPORT_CALL get(const K& aKey) const throw() override {
+			return const_cast<Self*>(this)->get(aKey);
+		}
+
+		T& SOLAIRE_EXPORT_CALL get(const K& aKey) throw() override {
+			T* const value = find(aKey);
+			// The key must be in the map, there is no value that could be returned otherwise
+			if(value == nullptr) std::terminate();
+			return *value;
+		}
+
+		bool SOLAIRE_EXPORT_CALL contains(const K& aKey) const throw() override {
+			return find(aKey) != nullptr;
+		}
+
+		bool SOLAIRE_EXPORT_CALL erase(const K& aKey) throw() override {
+			const int32_t i = lowerBound(aKey);
+			if(i == mEntries.size() || mCompare(aKey, mEntries[i].first)) return false;
+			return mEntries.erase(i);
+		}
+
+		void SOLAIRE_EXPORT_CALL clear() throw() override {
+			mEntries.clear();
+		}
+
+		int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+			return mEntries.size();
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+			return mEntries.getAllocator();
+		}
+
+		SharedAllocation<StaticContainer<const Entry>> SOLAIRE_EXPORT_CALL getEntries() const throw() override {
+			return makeMapView<EntrySource>(mEntries.getAllocator(), mEntries.data(), mEntries.size());
+		}
+
+		SharedAllocation<StaticContainer<const K>> SOLAIRE_EXPORT_CALL getKeys() const throw() override {
+			return makeMapView<Implementation::EntryKeySource<EntrySource>>(mEntries.getAllocator(), mEntries.data(), mEntries.size());
+		}
+
+		SharedAllocation<StaticContainer<const T>> SOLAIRE_EXPORT_CALL getValues() const throw() override {
+			return makeMapView<Implementation::EntryValueSource<EntrySource>>(mEntries.getAllocator(), mEntries.data(), mEntries.size());
+		}
+	};
+}
+
+#endif
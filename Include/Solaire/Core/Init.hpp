@@ -290,7 +290,7 @@ namespace Solaire{
 	#ifndef SOLAIRE_DISABLE_MULTITHREADING
 	#define SolaireSynchronized(aLock, aCode)\
 		{\
-			std::lock_guard<decltype(aLock)> _solaire_guard(aLock);\
+			std::lock_guard<typename std::remove_reference<decltype(aLock)>::type> _solaire_guard(aLock);\
 			aCode\
 		}
 	#else
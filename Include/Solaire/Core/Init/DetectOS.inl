@@ -47,6 +47,10 @@
     #include "OS/Windows.inl"
 #endif
 
+#if defined(__linux__) || defined(__linux)
+    #include "OS/Linux.inl"
+#endif
+
 // Post-checks
 
 #ifndef SOLAIRE_OS
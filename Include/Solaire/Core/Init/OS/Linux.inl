@@ -0,0 +1,51 @@
+#ifndef SOLAIRE_INIT_LINUX_INL
+#define SOLAIRE_INIT_LINUX_INL
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file Linux.inl
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#define SOLAIRE_OS SOLAIRE_LINUX
+
+#if defined(__LP64__) || defined(_LP64) || defined(__x86_64__) || defined(__aarch64__)
+    #define SOLAIRE_OS_BITS 64
+#else
+    #define SOLAIRE_OS_BITS 32
+#endif
+
+#include <unistd.h>
+
+// ELF shared objects export every symbol with default visibility, so import and export are the same
+#define SOLAIRE_OS_IMPORT_API __attribute__((visibility("default")))
+#define SOLAIRE_OS_EXPORT_API __attribute__((visibility("default")))
+#define SOLAIRE_OS_DEFAULT_API
+
+#define SOLAIRE_OS_DEFAULT_CALL
+
+#endif
@@ -0,0 +1,328 @@
+#ifndef SOLAIRE_INLINE_CONTAINER_HPP
+#define SOLAIRE_INLINE_CONTAINER_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file InlineContainer.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "Solaire/Core/ModuleHeader.hpp"
+#include "Solaire/Core/Simd.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		/*!
+			\brief Iterates over an InlineContainer by index.
+			\detail Every access is a non-virtual call to the container's getPtr, so a loop over it inlines completely.
+		*/
+		template<class C, class T>
+		class InlineIterator {
+		private:
+			C* mContainer;
+			int32_t mIndex;
+		public:
+			SOLAIRE_FORCE_INLINE InlineIterator(C& aContainer, const int32_t aIndex) throw() :
+				mContainer(&aContainer),
+				mIndex(aIndex)
+			{}
+
+			SOLAIRE_FORCE_INLINE InlineIterator<C, T>& operator++() throw() {
+				++mIndex;
+				return *this;
+			}
+
+			SOLAIRE_FORCE_INLINE InlineIterator<C, T>& operator--() throw() {
+				--mIndex;
+				return *this;
+			}
+
+			SOLAIRE_FORCE_INLINE bool operator==(const InlineIterator<C, T>& aOther) const throw() {
+				return mIndex == aOther.mIndex;
+			}
+
+			SOLAIRE_FORCE_INLINE bool operator!=(const InlineIterator<C, T>& aOther) const throw() {
+				return mIndex != aOther.mIndex;
+			}
+
+			SOLAIRE_FORCE_INLINE T& operator*() const throw() {
+				return *mContainer->getPtr(mIndex);
+			}
+
+			SOLAIRE_FORCE_INLINE T* operator->() const throw() {
+				return mContainer->getPtr(mIndex);
+			}
+		};
+	}
+
+	/*!
+		\class InlineContainer
+		\brief A non-virtual twin of StaticContainer that dispatches to \a DERIVED at compile time.
+		\detail DERIVED must provide these public members, none of which need to be virtual :
+			T* getPtr(int32_t)
+			const T* getPtr(int32_t) const
+			int32_t size() const
+			bool isContiguous() const
+		When isContiguous is a constant the branch between the pointer and index loops is removed, so
+		the searches and comparisons compile to the same code as a hand written loop.
+		Use VirtualContainer or VirtualList to pass an inline container across a module boundary.
+		\tparam DERIVED The class that is derived from this one.
+		\tparam T The type of element.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see StaticContainer
+	*/
+	template<class DERIVED, class T>
+	class InlineContainer {
+	public:
+		typedef T Type;
+		typedef T* Pointer;
+		typedef T& Reference;
+		typedef Implementation::InlineIterator<DERIVED, T> Iterator;
+		typedef Implementation::InlineIterator<const DERIVED, const T> ConstIterator;
+	private:
+		SOLAIRE_FORCE_INLINE DERIVED& derived() throw() {
+			return static_cast<DERIVED&>(*this);
+		}
+
+		SOLAIRE_FORCE_INLINE const DERIVED& derived() const throw() {
+			return static_cast<const DERIVED&>(*this);
+		}
+	public:
+		SOLAIRE_FORCE_INLINE T& operator[](const int32_t aIndex) throw() {
+			return *derived().getPtr(aIndex);
+		}
+
+		SOLAIRE_FORCE_INLINE const T& operator[](const int32_t aIndex) const throw() {
+			return *derived().getPtr(aIndex);
+		}
+
+		SOLAIRE_FORCE_INLINE Iterator begin() throw() {
+			return Iterator(derived(), 0);
+		}
+
+		SOLAIRE_FORCE_INLINE Iterator end() throw() {
+			return Iterator(derived(), derived().size());
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator begin() const throw() {
+			return ConstIterator(derived(), 0);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator end() const throw() {
+			return ConstIterator(derived(), derived().size());
+		}
+
+		template<class DERIVED2, class T2>
+		bool operator==(const InlineContainer<DERIVED2, T2>& aOther) const throw() {
+			static_assert(std::is_same<typename std::remove_const<T>::type, typename std::remove_const<T2>::type>::value, "SolaireCPP : InlineContainer can only be compared with containers of the same type");
+			const DERIVED& self = derived();
+			const DERIVED2& other = static_cast<const DERIVED2&>(aOther);
+			const int32_t length = self.size();
+			if(length != other.size()) return false;
+			if(length == 0) return true;
+			if(self.isContiguous() && other.isContiguous()) {
+				return Implementation::findMismatch<typename std::remove_const<T>::type>(self.getPtr(0), other.getPtr(0), 0, length) == length;
+			}else {
+				for(int32_t i = 0; i < length; ++i) {
+					if(! (*self.getPtr(i) == *other.getPtr(i))) return false;
+				}
+			}
+			return true;
+		}
+
+		template<class DERIVED2, class T2>
+		SOLAIRE_FORCE_INLINE bool operator!=(const InlineContainer<DERIVED2, T2>& aOther) const throw() {
+			return ! operator==(aOther);
+		}
+
+		/*!
+			\brief Lexicographically compare the elements with those of another container.
+			\return A negative value if this container orders first, 0 if they are equivalent or a positive value if \a aOther orders first.
+			\see StaticContainer::compare
+		*/
+		template<class DERIVED2, class T2>
+		int32_t compare(const InlineContainer<DERIVED2, T2>& aOther) const throw() {
+			static_assert(std::is_same<typename std::remove_const<T>::type, typename std::remove_const<T2>::type>::value, "SolaireCPP : InlineContainer can only be compared with containers of the same type");
+			typedef typename std::remove_const<T>::type Element;
+			const DERIVED& self = derived();
+			const DERIVED2& other = static_cast<const DERIVED2&>(aOther);
+			const int32_t length = self.size();
+			const int32_t otherLength = other.size();
+			if(length > 0 && otherLength > 0 && self.isContiguous() && other.isContiguous()) {
+				return Implementation::compareRange<Element>(self.getPtr(0), length, other.getPtr(0), otherLength);
+			}
+
+			const int32_t common = length < otherLength ? length : otherLength;
+			for(int32_t i = 0; i < common; ++i) {
+				const Element& a = *self.getPtr(i);
+				const Element& b = *other.getPtr(i);
+				if(a < b) return -1;
+				if(b < a) return 1;
+			}
+			return length < otherLength ? -1 : length > otherLength ? 1 : 0;
+		}
+
+		SOLAIRE_FORCE_INLINE int32_t findFirstOf(const T& aValue) const throw() {
+			return findNextOf(0, aValue);
+		}
+
+		inline int32_t findNextOf(const int32_t aIndex, const T& aValue) const throw() {
+			const DERIVED& self = derived();
+			if(self.isContiguous()) {
+				const int32_t length = self.size();
+				return length == 0 ? 0 : Implementation::searchForward(self.getPtr(0), aIndex, length, aValue);
+			}
+			return findNextIf(aIndex, [&aValue](const T& aElement) {
+				return aElement == aValue;
+			});
+		}
+
+		/*!
+			\return The index of the last match, or size() if there is none.
+		*/
+		inline int32_t findLastOf(const T& aValue) const throw() {
+			const DERIVED& self = derived();
+			if(self.isContiguous()) {
+				const int32_t length = self.size();
+				return length == 0 ? 0 : Implementation::searchBackward(self.getPtr(0), 0, length, aValue);
+			}
+			return findLastIf([&aValue](const T& aElement) {
+				return aElement == aValue;
+			});
+		}
+
+		template<class F>
+		SOLAIRE_FORCE_INLINE int32_t findFirstIf(const F aCondition) const throw() {
+			return findNextIf(0, aCondition);
+		}
+
+		template<class F>
+		inline int32_t findNextIf(const int32_t aIndex, const F aCondition) const throw() {
+			const DERIVED& self = derived();
+			const int32_t length = self.size();
+			if(self.isContiguous()) {
+				if(length == 0) return 0;
+				const T* const ptr = self.getPtr(0);
+				for(int32_t i = aIndex; i < length; ++i) {
+					if(aCondition(ptr[i])) return i;
+				}
+			}else {
+				for(int32_t i = aIndex; i < length; ++i) {
+					if(aCondition(*self.getPtr(i))) return i;
+				}
+			}
+			return length;
+		}
+
+		template<class F>
+		inline int32_t findLastIf(const F aCondition) const throw() {
+			const DERIVED& self = derived();
+			const int32_t length = self.size();
+			if(self.isContiguous()) {
+				if(length == 0) return 0;
+				const T* const ptr = self.getPtr(0);
+				for(int32_t i = length - 1; i >= 0; --i) {
+					if(aCondition(ptr[i])) return i;
+				}
+			}else {
+				for(int32_t i = length - 1; i >= 0; --i) {
+					if(aCondition(*self.getPtr(i))) return i;
+				}
+			}
+			return length;
+		}
+	};
+
+	/*!
+		\class InlineStack
+		\brief A non-virtual twin of Stack.
+		\detail In addition to the members required by InlineContainer, DERIVED should provide pushBack, popBack and clear.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see Stack
+	*/
+	template<class DERIVED, class T>
+	class InlineStack : public InlineContainer<DERIVED, T> {
+	public:
+		SOLAIRE_FORCE_INLINE T& back() throw() {
+			DERIVED& self = static_cast<DERIVED&>(*this);
+			return *self.getPtr(self.size() - 1);
+		}
+
+		SOLAIRE_FORCE_INLINE const T& back() const throw() {
+			const DERIVED& self = static_cast<const DERIVED&>(*this);
+			return *self.getPtr(self.size() - 1);
+		}
+	};
+
+	/*!
+		\class InlineDeque
+		\brief A non-virtual twin of Deque.
+		\detail In addition to the members required by InlineStack, DERIVED should provide pushFront and popFront.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see Deque
+	*/
+	template<class DERIVED, class T>
+	class InlineDeque : public InlineStack<DERIVED, T> {
+	public:
+		SOLAIRE_FORCE_INLINE T& front() throw() {
+			return *static_cast<DERIVED&>(*this).getPtr(0);
+		}
+
+		SOLAIRE_FORCE_INLINE const T& front() const throw() {
+			return *static_cast<const DERIVED&>(*this).getPtr(0);
+		}
+	};
+
+	/*!
+		\class InlineList
+		\brief A non-virtual twin of List.
+		\detail In addition to the members required by InlineDeque, DERIVED should provide insertBefore, insertAfter and erase.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see List
+	*/
+	template<class DERIVED, class T>
+	class InlineList : public InlineDeque<DERIVED, T> {
+
+	};
+}
+
+#endif
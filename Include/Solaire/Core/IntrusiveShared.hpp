@@ -0,0 +1,278 @@
+#ifndef SOLAIRE_INTRUSIVE_SHARED_HPP
+#define SOLAIRE_INTRUSIVE_SHARED_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file IntrusiveShared.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include "AllocatorI.hpp"
+#include "SharedAllocation.hpp"
+
+namespace Solaire {
+
+	template<class T>
+	class IntrusiveShared;
+
+	/*!
+		\class RefCounted
+		\brief A base class for objects that store their own user count.
+		\detail The object is destroyed and returned to its allocator when the last IntrusiveShared is released.
+		Derived classes must have been allocated from the allocator that is passed to the RefCounted constructor.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see IntrusiveShared
+	*/
+	class RefCounted {
+	public:
+		template<class T>
+		friend class IntrusiveShared;
+	private:
+		AllocatorI& mAllocator;
+		#ifdef SOLAIRE_DISABLE_MULTITHREADING
+			mutable SharedUserCount mUsers;
+		#else
+			mutable std::atomic<SharedUserCount> mUsers;
+		#endif
+	private:
+		void addUser() const throw() {
+			#ifdef SOLAIRE_DISABLE_MULTITHREADING
+				++mUsers;
+			#else
+				mUsers.fetch_add(1, std::memory_order_relaxed);
+			#endif
+		}
+
+		bool removeUser() const throw() {
+			#ifdef SOLAIRE_DISABLE_MULTITHREADING
+				if(mUsers == 0) return false;
+				const SharedUserCount users = mUsers--;
+			#else
+				const SharedUserCount users = mUsers.fetch_sub(1, std::memory_order_release);
+				if(users == 0) {
+					mUsers.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+			#endif
+			if(users == 1) {
+				#ifndef SOLAIRE_DISABLE_MULTITHREADING
+					std::atomic_thread_fence(std::memory_order_acquire);
+				#endif
+				RefCounted* const object = const_cast<RefCounted*>(this);
+				AllocatorI& allocator = mAllocator;
+				// The allocation begins at the most derived object, which may not be this base
+				void* const block = dynamic_cast<void*>(object);
+				object->~RefCounted();
+				allocator.deallocate(block);
+			}
+			return true;
+		}
+	protected:
+		RefCounted(AllocatorI& aAllocator) throw() :
+			mAllocator(aAllocator),
+			mUsers(0)
+		{}
+
+		RefCounted(const RefCounted& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mUsers(0)
+		{}
+
+		RefCounted& operator=(const RefCounted&) throw() {
+			// The user count belongs to the object's identity and is never copied
+			return *this;
+		}
+	public:
+		virtual ~RefCounted() throw() {
+
+		}
+
+		AllocatorI& getAllocator() const throw() {
+			return mAllocator;
+		}
+
+		SharedUserCount getUserCount() const throw() {
+			#ifdef SOLAIRE_DISABLE_MULTITHREADING
+				return mUsers;
+			#else
+				return mUsers.load(std::memory_order_relaxed);
+			#endif
+		}
+	};
+
+	/*!
+		\class IntrusiveShared
+		\brief A shared handle to an object that derives from RefCounted.
+		\detail Unlike SharedAllocation the handle points directly at the object,
+		so dereferencing does not need to load a SharedObject first.
+		\tparam T The type of the object, which must derive from RefCounted.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see RefCounted
+	*/
+	template<class T>
+	class IntrusiveShared {
+	public:
+		template<class T2>
+		friend class IntrusiveShared;
+	private:
+		static_assert(std::is_base_of<RefCounted, T>::value, "SolaireCPP : IntrusiveShared can only manage classes derived from RefCounted");
+	private:
+		T* mObject;
+	public:
+		IntrusiveShared() throw() :
+			mObject(nullptr)
+		{}
+
+		IntrusiveShared(T* const aObject) throw() :
+			mObject(aObject)
+		{
+			if(mObject) mObject->addUser();
+		}
+
+		IntrusiveShared(const IntrusiveShared<T>& aOther) throw() :
+			mObject(aOther.mObject)
+		{
+			if(mObject) mObject->addUser();
+		}
+
+		IntrusiveShared(IntrusiveShared<T>&& aOther) throw() :
+			mObject(aOther.mObject)
+		{
+			aOther.mObject = nullptr;
+		}
+
+		template<class T2, typename ENABLE = typename std::enable_if<std::is_convertible<T2*, T*>::value>::type>
+		IntrusiveShared(const IntrusiveShared<T2>& aOther) throw() :
+			mObject(aOther.mObject)
+		{
+			if(mObject) mObject->addUser();
+		}
+
+		template<class T2, typename ENABLE = typename std::enable_if<std::is_convertible<T2*, T*>::value>::type>
+		IntrusiveShared(IntrusiveShared<T2>&& aOther) throw() :
+			mObject(aOther.mObject)
+		{
+			aOther.mObject = nullptr;
+		}
+
+		~IntrusiveShared() throw() {
+			if(mObject) mObject->removeUser();
+		}
+
+		IntrusiveShared<T>& operator=(const IntrusiveShared<T>& aOther) throw() {
+			if(aOther.mObject) aOther.mObject->addUser();
+			if(mObject) mObject->removeUser();
+			mObject = aOther.mObject;
+			return *this;
+		}
+
+		IntrusiveShared<T>& operator=(IntrusiveShared<T>&& aOther) throw() {
+			swap(aOther);
+			return *this;
+		}
+
+		void swap(IntrusiveShared<T>& aOther) throw() {
+			std::swap(mObject, aOther.mObject);
+		}
+
+		void reset() throw() {
+			if(mObject) mObject->removeUser();
+			mObject = nullptr;
+		}
+
+		AllocatorI& getAllocator() const throw() {
+			return mObject->getAllocator();
+		}
+
+		SharedUserCount getUserCount() const throw() {
+			return mObject ? mObject->getUserCount() : 0;
+		}
+
+		operator bool() const throw() {
+			return mObject != nullptr;
+		}
+
+		T* get() const throw() {
+			return mObject;
+		}
+
+		T& operator*() const throw() {
+			return *mObject;
+		}
+
+		T* operator->() const throw() {
+			return mObject;
+		}
+
+		template<class T2>
+		bool operator==(const IntrusiveShared<T2>& aOther) const throw() {
+			return mObject == aOther.mObject;
+		}
+
+		template<class T2>
+		bool operator!=(const IntrusiveShared<T2>& aOther) const throw() {
+			return mObject != aOther.mObject;
+		}
+
+		template<class T2, typename ENABLE = typename std::enable_if<
+			std::is_base_of<T, T2>::value &&
+			! std::is_convertible<T*, T2*>::value
+		>::type>
+		explicit operator IntrusiveShared<T2>() const throw() {
+			return IntrusiveShared<T2>(static_cast<T2*>(mObject));
+		}
+	};
+
+	/*!
+		\brief Allocate and construct an object that derives from RefCounted.
+		\detail The allocator is passed to the object's constructor as the first parameter so that it can be forwarded to RefCounted.
+		\tparam T The type to allocate.
+		\tparam PARAMS The parameter types to pass to the object's constructor.
+		\param aAllocator The allocator that will own the object.
+		\param aParams The remaining parameters to pass to the object's constructor.
+		\return The shared object, or an empty IntrusiveShared if the allocation failed.
+	*/
+	template<class T, typename ...PARAMS>
+	IntrusiveShared<T> makeIntrusive(AllocatorI& aAllocator, PARAMS&&... aParams) throw() {
+		void* const block = static_cast<size_t>(alignof(T)) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+			aAllocator.allocateAligned(sizeof(T), alignof(T)) :
+			aAllocator.allocate(sizeof(T));
+		if(block == nullptr) return IntrusiveShared<T>();
+		return IntrusiveShared<T>(new(block) T(aAllocator, aParams...));
+	}
+}
+
+#endif
@@ -48,6 +48,19 @@ namespace Solaire {
         virtual T* SOLAIRE_EXPORT_CALL getPtr() throw() = 0;
     };
 
+    template<class T>
+    class StaticContainer;
+
+    /*!
+        \class STLIterator
+        \brief Adapts a StaticContainer to the STL iterator interface without allocating.
+        \detail If the container is contiguous the iterator steps a raw pointer, otherwise it reads each element by index through the container.
+        Either way copying, stepping and comparing an iterator never touches an allocator.
+        \author Adam Smith
+        \date Created : 3rd December 2015
+        \date Modified : 17th October 2026
+        \version 2.0
+    */
     template<class T>
     class STLIterator {
     public:
@@ -57,122 +70,242 @@ namespace Solaire {
         typedef const T* ConstPointer;
         typedef const T& ConstReference;
     private:
-        SharedAllocation<Iterator<T>> mIterator;
+        // The address of the first element that is visited, only used when the container is contiguous
+        Pointer mBase;
+        // Null when the container is contiguous
+        StaticContainer<T>* mContainer;
+        // The index of the first element that is visited
+        int32_t mFirst;
+        // 1 for a forward iterator, -1 for a reverse iterator
+        int32_t mDirection;
+        // The number of elements that have been visited
+        int32_t mOffset;
+    private:
+        SOLAIRE_FORCE_INLINE Pointer getPtr(const int32_t aOffset) const throw() {
+            return mContainer ? mContainer->getPtr(mFirst + mDirection * aOffset) : mBase + mDirection * aOffset;
+        }
     public:
-        STLIterator(SharedAllocation<Iterator<T>> aIterator) throw() :
-            mIterator(aIterator)
-        {}
-
-        ~STLIterator() throw() {
-
+        /*!
+            \param aContainer The container to iterate over.
+            \param aReverse True if the iterator should visit the elements from last to first.
+            \param aOffset The number of elements that have already been visited, size() for an end iterator.
+        */
+        STLIterator(StaticContainer<T>& aContainer, const bool aReverse, const int32_t aOffset) throw() :
+            mBase(nullptr),
+            mContainer(&aContainer),
+            mFirst(aReverse ? aContainer.size() - 1 : 0),
+            mDirection(aReverse ? -1 : 1),
+            mOffset(aOffset)
+        {
+            if(aContainer.isContiguous() && aContainer.size() > 0) {
+                mBase = aContainer.getPtr(mFirst);
+                mContainer = nullptr;
+            }
         }
 
         // Input Iterator
 
-        STLIterator<T>& operator++() throw() {
-            mIterator->increment(1);
+        SOLAIRE_FORCE_INLINE STLIterator<T>& operator++() throw() {
+            ++mOffset;
             return *this;
         }
 
-        SharedAllocation<Iterator<T>> operator++(int) throw() {
-            SharedAllocation<Iterator<T>> tmp = mIterator->copy();
-            mIterator->increment(1);
-            return STLIterator<T>(tmp);
+        SOLAIRE_FORCE_INLINE STLIterator<T> operator++(int) throw() {
+            const STLIterator<T> tmp = *this;
+            ++mOffset;
+            return tmp;
         }
 
-        bool operator==(const STLIterator<T> aOther) const throw() {
-            return aOther.mIterator->getOffset() == mIterator->getOffset();
+        SOLAIRE_FORCE_INLINE bool operator==(const STLIterator<T>& aOther) const throw() {
+            return aOther.mOffset == mOffset;
         }
 
-        bool operator!=(const STLIterator<T> aOther) const throw() {
-            return aOther.mIterator->getOffset() != mIterator->getOffset();
+        SOLAIRE_FORCE_INLINE bool operator!=(const STLIterator<T>& aOther) const throw() {
+            return aOther.mOffset != mOffset;
         }
 
-        ConstReference operator*() const throw() {
-            return *const_cast<STLIterator<T>*>(this)->mIterator->getPtr();
+        SOLAIRE_FORCE_INLINE ConstReference operator*() const throw() {
+            return *getPtr(mOffset);
         }
 
-        ConstPointer operator->() const throw() {
-            return const_cast<STLIterator<T>*>(this)->mIterator->getPtr();
+        SOLAIRE_FORCE_INLINE ConstPointer operator->() const throw() {
+            return getPtr(mOffset);
         }
 
         // Output Iterator
 
-        Reference operator*() throw() {
-            return *mIterator->getPtr();
+        SOLAIRE_FORCE_INLINE Reference operator*() throw() {
+            return *getPtr(mOffset);
         }
 
-        Pointer operator->() throw() {
-            return mIterator->getPtr();
+        SOLAIRE_FORCE_INLINE Pointer operator->() throw() {
+            return getPtr(mOffset);
         }
 
         // Bidirectional Iterator
 
-        STLIterator<T>& operator--() throw() {
-            mIterator->decrement(1);
+        SOLAIRE_FORCE_INLINE STLIterator<T>& operator--() throw() {
+            --mOffset;
             return *this;
         }
 
-        STLIterator<T> operator--(int) throw() {
-            SharedAllocation<Iterator<T>> tmp = mIterator->copy();
-            mIterator->decrement(1);
-            return STLIterator<T>(tmp);
+        SOLAIRE_FORCE_INLINE STLIterator<T> operator--(int) throw() {
+            const STLIterator<T> tmp = *this;
+            --mOffset;
+            return tmp;
         }
 
         // Random Access Iterator
 
-        STLIterator<T>& operator+=(const int32_t aCount) throw() {
-            mIterator->increment(aCount);
+        SOLAIRE_FORCE_INLINE STLIterator<T>& operator+=(const int32_t aCount) throw() {
+            mOffset += aCount;
             return *this;
         }
 
-        STLIterator<T> operator+(const int32_t aCount) throw() {
-            SharedAllocation<Iterator<T>> tmp = mIterator->copy();
-            tmp->increment(aCount);
-            return STLIterator(tmp);
+        SOLAIRE_FORCE_INLINE STLIterator<T> operator+(const int32_t aCount) const throw() {
+            STLIterator<T> tmp = *this;
+            tmp.mOffset += aCount;
+            return tmp;
+        }
+
+        SOLAIRE_FORCE_INLINE STLIterator<T>& operator-=(const int32_t aCount) throw() {
+            mOffset -= aCount;
+            return *this;
+        }
+
+        SOLAIRE_FORCE_INLINE STLIterator<T> operator-(const int32_t aCount) const throw() {
+            STLIterator<T> tmp = *this;
+            tmp.mOffset -= aCount;
+            return tmp;
+        }
+
+        SOLAIRE_FORCE_INLINE int32_t operator-(const STLIterator<T>& aOther) const throw() {
+            return mOffset - aOther.mOffset;
+        }
+
+        SOLAIRE_FORCE_INLINE Reference operator[](const int32_t aOffset) throw() {
+            return *getPtr(mOffset + aOffset);
+        }
+
+        SOLAIRE_FORCE_INLINE ConstReference operator[](const int32_t aOffset) const throw() {
+            return *getPtr(mOffset + aOffset);
+        }
+
+        SOLAIRE_FORCE_INLINE bool operator<(const STLIterator<T>& aOther) const throw() {
+            return mOffset < aOther.mOffset;
+        }
+
+        SOLAIRE_FORCE_INLINE bool operator>(const STLIterator<T>& aOther) const throw() {
+            return mOffset > aOther.mOffset;
+        }
+
+        SOLAIRE_FORCE_INLINE bool operator<=(const STLIterator<T>& aOther) const throw() {
+            return mOffset <= aOther.mOffset;
+        }
+
+        SOLAIRE_FORCE_INLINE bool operator>=(const STLIterator<T>& aOther) const throw() {
+            return mOffset >= aOther.mOffset;
         }
+    };
+
+    /*!
+        \class ContiguousIterator
+        \brief Iterates forwards over elements that are stored in a single block of memory.
+        \author Adam Smith
+        \date Created : 17th October 2026
+        \date Modified : 17th October 2026
+        \version 1.0
+    */
+    template<class T>
+    class ContiguousIterator : public Iterator<T> {
+    private:
+        AllocatorI& mAllocator;
+        T* mBase;
+        int32_t mOffset;
+    public:
+        ContiguousIterator(AllocatorI& aAllocator, T* const aBase, const int32_t aOffset) throw() :
+            mAllocator(aAllocator),
+            mBase(aBase),
+            mOffset(aOffset)
+        {}
+
+        SOLAIRE_EXPORT_CALL ~ContiguousIterator() throw() {
 
-        STLIterator<T>& operator-=(const int32_t aCount) throw() {
-            mIterator->decrement(aCount);
+        }
+
+        // Inherited from Iterator
+
+        Iterator<T>& SOLAIRE_EXPORT_CALL increment(const int32_t aCount) throw() override {
+            mOffset += aCount;
             return *this;
         }
 
-        STLIterator<T> operator-(const int32_t aCount) throw() {
-            SharedAllocation<Iterator<T>> tmp = mIterator->copy();
-            tmp.decrement(aCount);
-            return STLIterator(tmp);
+        Iterator<T>& SOLAIRE_EXPORT_CALL decrement(const int32_t aCount) throw() override {
+            mOffset -= aCount;
+            return *this;
         }
 
-        int32_t operator-(const STLIterator<T>&aOther) const throw() {
-            return mIterator->getOffset() - aOther.mIterator->getOffset();
+        SharedAllocation<Iterator<T>> SOLAIRE_EXPORT_CALL copy() const throw() override {
+            return makeSharedAs<Iterator<T>, ContiguousIterator<T>>(mAllocator, mAllocator, mBase, mOffset);
         }
 
-        Reference operator[](const int32_t aOffset) throw() {
-            SharedAllocation<Iterator<T>> tmp = mIterator->copy();
-            tmp.increment(aOffset);
-            return **tmp;
+        int32_t SOLAIRE_EXPORT_CALL getOffset() const throw() override {
+            return mOffset;
         }
 
-        ConstReference operator[](const int32_t aOffset) const throw() {
-            SharedAllocation<Iterator<T>> tmp = mIterator->copy();
-            tmp.increment(aOffset);
-            return **tmp;
+        T* SOLAIRE_EXPORT_CALL getPtr() throw() override {
+            return mBase + mOffset;
         }
+    };
 
-        bool operator<(const STLIterator<T> aOther) const throw() {
-            return aOther.mIterator->getOffset() < mIterator->getOffset();
+    /*!
+        \class ReverseContiguousIterator
+        \brief Iterates backwards over elements that are stored in a single block of memory.
+        \detail The offset counts the number of elements that have been visited, starting from \a aLast.
+        \author Adam Smith
+        \date Created : 17th October 2026
+        \date Modified : 17th October 2026
+        \version 1.0
+    */
+    template<class T>
+    class ReverseContiguousIterator : public Iterator<T> {
+    private:
+        AllocatorI& mAllocator;
+        T* mLast;
+        int32_t mOffset;
+    public:
+        ReverseContiguousIterator(AllocatorI& aAllocator, T* const aLast, const int32_t aOffset) throw() :
+            mAllocator(aAllocator),
+            mLast(aLast),
+            mOffset(aOffset)
+        {}
+
+        SOLAIRE_EXPORT_CALL ~ReverseContiguousIterator() throw() {
+
+        }
+
+        // Inherited from Iterator
+
+        Iterator<T>& SOLAIRE_EXPORT_CALL increment(const int32_t aCount) throw() override {
+            mOffset += aCount;
+            return *this;
+        }
+
+        Iterator<T>& SOLAIRE_EXPORT_CALL decrement(const int32_t aCount) throw() override {
+            mOffset -= aCount;
+            return *this;
         }
 
-        bool operator>(const STLIterator<T> aOther) const throw() {
-            return aOther.mIterator->getOffset() > mIterator->getOffset();
+        SharedAllocation<Iterator<T>> SOLAIRE_EXPORT_CALL copy() const throw() override {
+            return makeSharedAs<Iterator<T>, ReverseContiguousIterator<T>>(mAllocator, mAllocator, mLast, mOffset);
         }
 
-        bool operator<=(const STLIterator<T> aOther) const throw() {
-            return aOther.mIterator->getOffset() <= mIterator->getOffset();
+        int32_t SOLAIRE_EXPORT_CALL getOffset() const throw() override {
+            return mOffset;
         }
 
-        bool operator>=(const STLIterator<T> aOther) const throw() {
-            return aOther.mIterator->getOffset() >= mIterator->getOffset();
+        T* SOLAIRE_EXPORT_CALL getPtr() throw() override {
+            return mLast - mOffset;
         }
     };
 }
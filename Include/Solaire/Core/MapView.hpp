@@ -0,0 +1,292 @@
+#ifndef SOLAIRE_MAP_VIEW_HPP
+#define SOLAIRE_MAP_VIEW_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file MapView.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <type_traits>
+#include <utility>
+#include "Solaire/Core/DynamicArray.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		/*
+			A view source provides the elements of a MapView :
+				typedef Type						The element type, including const
+				Type* getPtr(int32_t)				The address of an element, may update an internal cursor
+				int32_t size() const				The number of elements
+				bool isContiguous() const			True if getPtr(0) addresses every element
+		*/
+
+		/*!
+			\brief Views elements that are stored in a single block of memory owned by somebody else.
+		*/
+		template<class T>
+		class ContiguousViewSource {
+		public:
+			typedef T Type;
+		private:
+			T* mData;
+			int32_t mSize;
+		public:
+			ContiguousViewSource(T* const aData, const int32_t aSize) throw() :
+				mData(aData),
+				mSize(aSize)
+			{}
+
+			SOLAIRE_FORCE_INLINE T* getPtr(const int32_t aIndex) throw() {
+				return mData + aIndex;
+			}
+
+			SOLAIRE_FORCE_INLINE int32_t size() const throw() {
+				return mSize;
+			}
+
+			SOLAIRE_FORCE_INLINE bool isContiguous() const throw() {
+				return true;
+			}
+		};
+
+		/*!
+			\brief Views elements that have been copied into an array owned by the view.
+			\detail Used by maps that can only provide a snapshot of their contents.
+		*/
+		template<class T>
+		class ArrayViewSource {
+		public:
+			typedef T Type;
+		private:
+			DynamicArray<typename std::remove_const<T>::type> mArray;
+		public:
+			ArrayViewSource(DynamicArray<typename std::remove_const<T>::type>&& aArray) throw() :
+				mArray(std::move(aArray))
+			{}
+
+			SOLAIRE_FORCE_INLINE T* getPtr(const int32_t aIndex) throw() {
+				return mArray.data() + aIndex;
+			}
+
+			SOLAIRE_FORCE_INLINE int32_t size() const throw() {
+				return mArray.size();
+			}
+
+			SOLAIRE_FORCE_INLINE bool isContiguous() const throw() {
+				return true;
+			}
+		};
+
+		/*!
+			\brief Views the keys of the entries provided by another source.
+			\tparam SOURCE A source of const std::pair<K, T>.
+		*/
+		template<class SOURCE>
+		class EntryKeySource {
+		public:
+			typedef const typename std::remove_const<typename SOURCE::Type>::type::first_type Type;
+		private:
+			SOURCE mSource;
+		public:
+			template<typename ...PARAMS>
+			EntryKeySource(PARAMS&&... aParams) throw() :
+				mSource(std::forward<PARAMS>(aParams)...)
+			{}
+
+			SOLAIRE_FORCE_INLINE Type* getPtr(const int32_t aIndex) throw() {
+				return &mSource.getPtr(aIndex)->first;
+			}
+
+			SOLAIRE_FORCE_INLINE int32_t size() const throw() {
+				return mSource.size();
+			}
+
+			SOLAIRE_FORCE_INLINE bool isContiguous() const throw() {
+				// The keys are interleaved with the values
+				return false;
+			}
+		};
+
+		/*!
+			\brief Views the values of the entries provided by another source.
+			\tparam SOURCE A source of const std::pair<K, T>.
+		*/
+		template<class SOURCE>
+		class EntryValueSource {
+		public:
+			typedef const typename std::remove_const<typename SOURCE::Type>::type::second_type Type;
+		private:
+			SOURCE mSource;
+		public:
+			template<typename ...PARAMS>
+			EntryValueSource(PARAMS&&... aParams) throw() :
+				mSource(std::forward<PARAMS>(aParams)...)
+			{}
+
+			SOLAIRE_FORCE_INLINE Type* getPtr(const int32_t aIndex) throw() {
+				return &mSource.getPtr(aIndex)->second;
+			}
+
+			SOLAIRE_FORCE_INLINE int32_t size() const throw() {
+				return mSource.size();
+			}
+
+			SOLAIRE_FORCE_INLINE bool isContiguous() const throw() {
+				return false;
+			}
+		};
+	}
+
+	/*!
+		\class MapView
+		\brief A read only StaticContainer over the storage of a Map.
+		\detail The elements are not copied, each access is forwarded to \a SOURCE.
+		A view is invalidated by any modification of the map that it was created from.
+		\tparam SOURCE Provides the elements, see the sources in Solaire::Implementation.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see Map::getEntries
+	*/
+	template<class SOURCE>
+	class MapView : public StaticContainer<typename SOURCE::Type> {
+	public:
+		typedef typename SOURCE::Type Type;
+		typedef Type* Pointer;
+		typedef MapView<SOURCE> Self;
+	private:
+		class ViewIterator : public Iterator<Type> {
+		private:
+			MapView<SOURCE>& mView;
+			int32_t mOffset;
+			bool mReverse;
+		public:
+			ViewIterator(MapView<SOURCE>& aView, const int32_t aOffset, const bool aReverse) throw() :
+				mView(aView),
+				mOffset(aOffset),
+				mReverse(aReverse)
+			{}
+
+			SOLAIRE_EXPORT_CALL ~ViewIterator() throw() {
+
+			}
+
+			// Inherited from Iterator
+
+			Iterator<Type>& SOLAIRE_EXPORT_CALL increment(const int32_t aCount) throw() override {
+				mOffset += aCount;
+				return *this;
+			}
+
+			Iterator<Type>& SOLAIRE_EXPORT_CALL decrement(const int32_t aCount) throw() override {
+				mOffset -= aCount;
+				return *this;
+			}
+
+			SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL copy() const throw() override {
+				return makeSharedAs<Iterator<Type>, ViewIterator>(mView.mAllocator, mView, mOffset, mReverse);
+			}
+
+			int32_t SOLAIRE_EXPORT_CALL getOffset() const throw() override {
+				return mOffset;
+			}
+
+			Type* SOLAIRE_EXPORT_CALL getPtr() throw() override {
+				return mView.getPtr(mReverse ? mView.mSource.size() - 1 - mOffset : mOffset);
+			}
+		};
+	private:
+		Allocator& mAllocator;
+		SOURCE mSource;
+	private:
+		MapView(const Self&) = delete;
+		MapView(Self&&) = delete;
+		Self& operator=(const Self&) = delete;
+		Self& operator=(Self&&) = delete;
+	protected:
+		// Inherited from StaticContainer
+
+		Pointer SOLAIRE_EXPORT_CALL getPtr(int32_t aIndex) throw() override {
+			return mSource.getPtr(aIndex);
+		}
+
+		SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL begin_() throw() override {
+			return makeSharedAs<Iterator<Type>, ViewIterator>(mAllocator, *this, 0, false);
+		}
+
+		SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL end_() throw() override {
+			return makeSharedAs<Iterator<Type>, ViewIterator>(mAllocator, *this, mSource.size(), false);
+		}
+
+		SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rbegin_() throw() override {
+			return makeSharedAs<Iterator<Type>, ViewIterator>(mAllocator, *this, 0, true);
+		}
+
+		SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rend_() throw() override {
+			return makeSharedAs<Iterator<Type>, ViewIterator>(mAllocator, *this, mSource.size(), true);
+		}
+	public:
+		template<typename ...PARAMS>
+		MapView(Allocator& aAllocator, PARAMS&&... aParams) throw() :
+			mAllocator(aAllocator),
+			mSource(std::forward<PARAMS>(aParams)...)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~MapView() throw() {
+
+		}
+
+		// Inherited from StaticContainer
+
+		bool SOLAIRE_EXPORT_CALL isContiguous() const throw() override {
+			return mSource.isContiguous();
+		}
+
+		int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+			return mSource.size();
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+			return mAllocator;
+		}
+	};
+
+	/*!
+		\brief Create a view of a map's storage.
+		\param aAllocator The allocator that the view and its iterators are allocated with.
+		\param aParams The parameters passed to the constructor of \a SOURCE.
+		\return The view, or a null allocation if it could not be allocated.
+	*/
+	template<class SOURCE, typename ...PARAMS>
+	SharedAllocation<StaticContainer<typename SOURCE::Type>> makeMapView(Allocator& aAllocator, PARAMS&&... aParams) throw() {
+		return makeSharedAs<StaticContainer<typename SOURCE::Type>, MapView<SOURCE>>(aAllocator, aAllocator, std::forward<PARAMS>(aParams)...);
+	}
+}
+
+#endif
@@ -0,0 +1,265 @@
+#ifndef SOLAIRE_MPMC_QUEUE_HPP
+#define SOLAIRE_MPMC_QUEUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file MpmcQueue.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include "Solaire/Core/SpscQueue.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class MpmcQueue
+		\brief A bounded queue that any number of threads can push to and pop from.
+		\detail Each slot of the ring buffer carries a sequence number that says whether it is ready to be written or read for a given ticket.
+		Producers and consumers claim tickets with a compare and swap on the tail or head and never wait on each other,
+		a full or empty queue is reported instead of blocking.
+		\tparam T The type of element to store.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see SpscQueue
+	*/
+	template<class T>
+	class MpmcQueue {
+	public:
+		typedef T Type;
+		typedef MpmcQueue<T> Self;
+	private:
+		enum : uint32_t {
+			CACHE_LINE_SIZE = 64
+		};
+
+		struct Cell {
+			// Equals the ticket that may write the cell when it is empty and that ticket + 1 when it is full
+			std::atomic<uint32_t> sequence;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+			SOLAIRE_FORCE_INLINE T& get() throw() {
+				return *reinterpret_cast<T*>(&storage);
+			}
+		};
+	private:
+		Allocator& mAllocator;
+		Cell* mCells;
+		uint32_t mMask;
+		uint8_t mPadding0[CACHE_LINE_SIZE];
+		std::atomic<uint32_t> mTail;
+		uint8_t mPadding1[CACHE_LINE_SIZE];
+		std::atomic<uint32_t> mHead;
+		uint8_t mPadding2[CACHE_LINE_SIZE];
+	private:
+		MpmcQueue(const Self&) = delete;
+		MpmcQueue(Self&&) = delete;
+		Self& operator=(const Self&) = delete;
+		Self& operator=(Self&&) = delete;
+
+		void allocate(const int32_t aCapacity) throw() {
+			const uint32_t capacity = Implementation::queueCapacity(aCapacity);
+			if(capacity == 0) return;
+			const size_t bytes = sizeof(Cell) * static_cast<size_t>(capacity);
+			mCells = static_cast<Cell*>(alignof(Cell) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+				mAllocator.allocateAligned(bytes, alignof(Cell)) :
+				mAllocator.allocate(bytes)
+			);
+			if(mCells == nullptr) return;
+			mMask = capacity - 1;
+			for(uint32_t i = 0; i < capacity; ++i) new(&mCells[i].sequence) std::atomic<uint32_t>(i);
+		}
+
+		static SOLAIRE_FORCE_INLINE int32_t distance(const uint32_t aSequence, const uint32_t aTicket) throw() {
+			return static_cast<int32_t>(aSequence - aTicket);
+		}
+
+		/*!
+			\brief Claim up to \a aCount consecutive cells whose sequence is their ticket + \a aOffset.
+			\param aIndex The head or tail to claim tickets from.
+			\param aOffset 0 to claim empty cells, 1 to claim full cells.
+			\param aCount The maximum number of cells to claim.
+			\param aTicket Set to the first claimed ticket.
+			\return The number of cells claimed.
+		*/
+		uint32_t claim(std::atomic<uint32_t>& aIndex, const uint32_t aOffset, const uint32_t aCount, uint32_t& aTicket) throw() {
+			if(mCells == nullptr) return 0;
+			uint32_t ticket = aIndex.load(std::memory_order_relaxed);
+			while(true) {
+				const int32_t difference = distance(mCells[ticket & mMask].sequence.load(std::memory_order_acquire), ticket + aOffset);
+				if(difference < 0) {
+					// The cell has not been released by the other side yet, so the queue is full or empty
+					return 0;
+				}else if(difference > 0) {
+					// Another thread has already claimed this ticket
+					ticket = aIndex.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				// While the index is unchanged no other thread can claim the following cells, so any that are ready can be taken together
+				uint32_t count = 1;
+				while(count < aCount && distance(mCells[(ticket + count) & mMask].sequence.load(std::memory_order_acquire), ticket + count + aOffset) == 0) ++count;
+
+				if(aIndex.compare_exchange_weak(ticket, ticket + count, std::memory_order_relaxed)) {
+					aTicket = ticket;
+					return count;
+				}
+			}
+		}
+	public:
+		MpmcQueue(const int32_t aCapacity) throw() :
+			mAllocator(getDefaultAllocator()),
+			mCells(nullptr),
+			mMask(0),
+			mTail(0),
+			mHead(0)
+		{
+			allocate(aCapacity);
+		}
+
+		MpmcQueue(Allocator& aAllocator, const int32_t aCapacity) throw() :
+			mAllocator(aAllocator),
+			mCells(nullptr),
+			mMask(0),
+			mTail(0),
+			mHead(0)
+		{
+			allocate(aCapacity);
+		}
+
+		~MpmcQueue() throw() {
+			if(mCells == nullptr) return;
+			if(! std::is_trivially_destructible<T>::value) {
+				const uint32_t tail = mTail.load(std::memory_order_relaxed);
+				for(uint32_t i = mHead.load(std::memory_order_relaxed); i != tail; ++i) mCells[i & mMask].get().~T();
+			}
+			mAllocator.deallocate(mCells);
+		}
+
+		/*!
+			\brief Add an element to the back of the queue.
+			\return False if the queue is full.
+		*/
+		bool tryPush(const T& aValue) throw() {
+			uint32_t ticket;
+			if(claim(mTail, 0, 1, ticket) == 0) return false;
+			Cell& cell = mCells[ticket & mMask];
+			new(&cell.storage) T(aValue);
+			cell.sequence.store(ticket + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool tryPush(T&& aValue) throw() {
+			uint32_t ticket;
+			if(claim(mTail, 0, 1, ticket) == 0) return false;
+			Cell& cell = mCells[ticket & mMask];
+			new(&cell.storage) T(std::move(aValue));
+			cell.sequence.store(ticket + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*!
+			\brief Add up to \a aCount elements to the back of the queue with a single claim.
+			\detail The elements take consecutive tickets, so elements from other producers cannot interleave with them.
+			\param aValues The elements to copy.
+			\param aCount The number of elements in \a aValues.
+			\return The number of elements that were pushed, which is 0 only if the queue is full.
+		*/
+		int32_t tryPushBatch(const T* const aValues, const int32_t aCount) throw() {
+			if(aCount <= 0) return 0;
+			uint32_t ticket;
+			const uint32_t count = claim(mTail, 0, static_cast<uint32_t>(aCount), ticket);
+			for(uint32_t i = 0; i < count; ++i) {
+				Cell& cell = mCells[(ticket + i) & mMask];
+				new(&cell.storage) T(aValues[i]);
+				cell.sequence.store(ticket + i + 1, std::memory_order_release);
+			}
+			return static_cast<int32_t>(count);
+		}
+
+		/*!
+			\brief Remove the element at the front of the queue.
+			\param aValue Set to the element if one was removed.
+			\return False if the queue is empty.
+		*/
+		bool tryPop(T& aValue) throw() {
+			uint32_t ticket;
+			if(claim(mHead, 1, 1, ticket) == 0) return false;
+			Cell& cell = mCells[ticket & mMask];
+			aValue = std::move(cell.get());
+			cell.get().~T();
+			// The cell is next written by the ticket one lap ahead
+			cell.sequence.store(ticket + mMask + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*!
+			\brief Remove up to \a aCount elements from the front of the queue with a single claim.
+			\param aValues Receives the elements in queue order.
+			\param aCount The maximum number of elements to remove.
+			\return The number of elements that were removed, which is 0 only if the queue is empty.
+		*/
+		int32_t tryPopBatch(T* const aValues, const int32_t aCount) throw() {
+			if(aCount <= 0) return 0;
+			uint32_t ticket;
+			const uint32_t count = claim(mHead, 1, static_cast<uint32_t>(aCount), ticket);
+			for(uint32_t i = 0; i < count; ++i) {
+				Cell& cell = mCells[(ticket + i) & mMask];
+				aValues[i] = std::move(cell.get());
+				cell.get().~T();
+				cell.sequence.store(ticket + i + mMask + 1, std::memory_order_release);
+			}
+			return static_cast<int32_t>(count);
+		}
+
+		/*!
+			\return The number of claimed elements in the queue, which may already be out of date if other threads are active.
+		*/
+		int32_t size() const throw() {
+			const uint32_t head = mHead.load(std::memory_order_acquire);
+			const int32_t size = static_cast<int32_t>(mTail.load(std::memory_order_acquire) - head);
+			return size < 0 ? 0 : size;
+		}
+
+		bool isEmpty() const throw() {
+			return size() == 0;
+		}
+
+		/*!
+			\return The maximum number of elements, or 0 if the storage could not be allocated.
+		*/
+		int32_t capacity() const throw() {
+			return mCells ? static_cast<int32_t>(mMask + 1) : 0;
+		}
+
+		Allocator& getAllocator() const throw() {
+			return mAllocator;
+		}
+	};
+}
+
+#endif
@@ -19,17 +19,50 @@
 // Email             : solairelibrary@mail.com
 // GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
 
-#include "Solaire\Core\Allocator.hpp"
-#include <map>
+/*!
+	\file NewAllocator.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 25th September 2015
+	Last Modified	: 17th October 2026
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include "Solaire/Core/Allocator.hpp"
 
 namespace Solaire{
 
 	class NewAllocator : public Allocator {
 	private:
-		std::map<const void*, uint32_t> mAllocations;
-		uint32_t mAllocatedBytes;
+		// Every block is prefixed with a header so that size lookups and deallocation never search
+		// The alignment pads the header so that the block after it is aligned for any type
+		struct alignas(std::max_align_t) Header {
+			Header* prev;
+			Header* next;
+			const NewAllocator* owner;
+			size_t size;
+			size_t offset;
+		};
+	private:
+		Header* mAllocations;
+		uint64_t mAllocatedBytes;
+	private:
+		NewAllocator(const NewAllocator&) = delete;
+		NewAllocator& operator=(const NewAllocator&) = delete;
+
+		SOLAIRE_FORCE_INLINE Header* getHeader(const void* const aObject) const throw() {
+			Header* const header = static_cast<Header*>(const_cast<void*>(aObject)) - 1;
+			return header->owner == this ? header : nullptr;
+		}
 	public:
 		NewAllocator() :
+			mAllocations(nullptr),
 			mAllocatedBytes(0)
 		{}
 
@@ -37,41 +70,91 @@ namespace Solaire{
 			deallocateAll();
 		}
 
+		uint64_t getAllocatedBytes64() const throw() {
+			return mAllocatedBytes;
+		}
+
 		// Inherited from Allocator
 
 		uint32_t SOLAIRE_EXPORT_CALL getAllocatedBytes() const throw()  override {
-			return mAllocatedBytes;
+			return mAllocatedBytes > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(mAllocatedBytes);
 		}
 
 		uint32_t SOLAIRE_EXPORT_CALL getFreeBytes() const throw() override {
-			return UINT32_MAX - mAllocatedBytes;
+			return UINT32_MAX - getAllocatedBytes();
 		}
 
 		uint32_t SOLAIRE_EXPORT_CALL sizeOf(const void* const aObject) throw() override {
-			auto it = mAllocations.find(aObject);
-			if(it == mAllocations.end()) return 0;
-			return it->second;
+			if(aObject == nullptr) return 0;
+			const Header* const header = getHeader(aObject);
+			if(header == nullptr) return 0;
+			return header->size > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(header->size);
 		}
 
 		void* SOLAIRE_EXPORT_CALL allocate(const size_t aBytes) throw() override {
-			void* const tmp = operator new(aBytes);
-			mAllocations.emplace(tmp, aBytes);
-			mAllocatedBytes += aBytes;
-			return tmp;
+			return allocateAligned(aBytes, alignof(Header));
 		}
 
 		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject) throw() override {
-			auto it = mAllocations.find(aObject);
-			if(it == mAllocations.end()) return false;
-			operator delete(const_cast<void*>(aObject));
-			mAllocatedBytes -= it->second;
-			mAllocations.erase(it);
+			if(aObject == nullptr) return false;
+			Header* const header = getHeader(aObject);
+			if(header == nullptr) return false;
+			if(header->prev != nullptr) header->prev->next = header->next;
+			else mAllocations = header->next;
+			if(header->next != nullptr) header->next->prev = header->prev;
+			mAllocatedBytes -= header->size;
+			header->owner = nullptr;
+			operator delete(reinterpret_cast<uint8_t*>(header) - header->offset);
 			return true;
 		}
 
-		bool SOLAIRE_EXPORT_CALL deallocateAll() throw() {
-			for(auto i : mAllocations) {
-				operator delete(const_cast<void*>(i.first));
+		void* SOLAIRE_EXPORT_CALL allocateAligned(const size_t aBytes, const size_t aAlignment) throw() override {
+			const size_t padding = aAlignment > alignof(Header) ? aAlignment - 1 : 0;
+			uint8_t* const base = static_cast<uint8_t*>(operator new(sizeof(Header) + padding + aBytes, std::nothrow));
+			if(base == nullptr) return nullptr;
+
+			const uintptr_t block = (reinterpret_cast<uintptr_t>(base + sizeof(Header)) + padding) & ~static_cast<uintptr_t>(padding);
+			Header* const header = reinterpret_cast<Header*>(block) - 1;
+			header->prev = nullptr;
+			header->next = mAllocations;
+			header->owner = this;
+			header->size = aBytes;
+			header->offset = reinterpret_cast<uint8_t*>(header) - base;
+			if(mAllocations != nullptr) mAllocations->prev = header;
+			mAllocations = header;
+			mAllocatedBytes += aBytes;
+			return header + 1;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject, const size_t) throw() override {
+			return deallocate(aObject);
+		}
+
+		void* SOLAIRE_EXPORT_CALL reallocate(const void* const aObject, const size_t aBytes) throw() override {
+			if(aObject == nullptr) return allocate(aBytes);
+			Header* const header = getHeader(aObject);
+			if(header == nullptr) return nullptr;
+
+			// Shrinking never needs to move the block
+			if(aBytes <= header->size) {
+				mAllocatedBytes -= header->size - aBytes;
+				header->size = aBytes;
+				return const_cast<void*>(aObject);
+			}
+
+			void* const tmp = allocate(aBytes);
+			if(tmp == nullptr) return nullptr;
+			std::memcpy(tmp, aObject, header->size);
+			deallocate(aObject);
+			return tmp;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocateAll() throw() override {
+			while(mAllocations != nullptr) {
+				Header* const next = mAllocations->next;
+				mAllocations->owner = nullptr;
+				operator delete(reinterpret_cast<uint8_t*>(mAllocations) - mAllocations->offset);
+				mAllocations = next;
 			}
 			mAllocatedBytes = 0;
 			return true;
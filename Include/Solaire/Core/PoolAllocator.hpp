@@ -0,0 +1,246 @@
+#ifndef SOLAIRE_POOL_ALLOCATOR_HPP
+#define SOLAIRE_POOL_ALLOCATOR_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file PoolAllocator.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <cstddef>
+#include <new>
+#include "Solaire/Core/Allocator.hpp"
+
+namespace Solaire{
+
+	/*!
+		\class PoolAllocator
+		\brief An Allocator that hands out fixed size blocks from an intrusive free list.
+		\detail Requests larger than \a SIZE fail. Blocks are carved from pages of \a BLOCKS_PER_PAGE blocks,
+		pages are only returned to the system when the PoolAllocator is destroyed.
+		\tparam SIZE The largest allocation that the pool can serve.
+		\tparam ALIGN The alignment of every block.
+		\tparam BLOCKS_PER_PAGE The number of blocks to reserve each time the pool grows.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+	*/
+	template<const uint32_t SIZE, const uint32_t ALIGN = alignof(std::max_align_t), const uint32_t BLOCKS_PER_PAGE = 256>
+	class PoolAllocator : public Allocator {
+	public:
+		enum : uint32_t {
+			BLOCK_ALIGN = ALIGN > alignof(void*) ? ALIGN : alignof(void*),
+			BLOCK_SIZE = ((SIZE > sizeof(void*) ? SIZE : sizeof(void*)) + BLOCK_ALIGN - 1) & ~(BLOCK_ALIGN - 1),
+			PAGE_SIZE = BLOCK_SIZE * BLOCKS_PER_PAGE
+		};
+	private:
+		static_assert((ALIGN & (ALIGN - 1)) == 0, "SolaireCPP : PoolAllocator alignment must be a power of 2");
+		static_assert(BLOCKS_PER_PAGE > 0, "SolaireCPP : PoolAllocator must have at least 1 block per page");
+
+		struct Block {
+			Block* next;
+		};
+
+		struct Page {
+			Page* next;
+
+			SOLAIRE_FORCE_INLINE uintptr_t begin() const throw() {
+				const uintptr_t address = reinterpret_cast<uintptr_t>(this + 1);
+				return (address + BLOCK_ALIGN - 1) & ~static_cast<uintptr_t>(BLOCK_ALIGN - 1);
+			}
+		};
+	private:
+		Block* mFreeList;
+		Page* mPages;
+		Page* mCurrent;
+		uintptr_t mTop;
+		uintptr_t mEnd;
+		uint32_t mPageCount;
+		uint32_t mPageIndex;
+		uint32_t mAllocatedBlocks;
+		uint32_t mFreeBlocks;
+	private:
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator(PoolAllocator&&) = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+		bool nextPage() throw() {
+			Page* const next = mCurrent == nullptr ? mPages : mCurrent->next;
+			if(next != nullptr) {
+				mCurrent = next;
+			}else {
+				Page* const page = static_cast<Page*>(operator new(sizeof(Page) + BLOCK_ALIGN + PAGE_SIZE, std::nothrow));
+				if(page == nullptr) return false;
+				page->next = nullptr;
+				if(mCurrent == nullptr) mPages = page;
+				else mCurrent->next = page;
+				mCurrent = page;
+				++mPageCount;
+			}
+
+			mPageIndex = mCurrent == mPages ? 0 : mPageIndex + 1;
+			mTop = mCurrent->begin();
+			mEnd = mTop + PAGE_SIZE;
+			return true;
+		}
+	public:
+		PoolAllocator() throw() :
+			mFreeList(nullptr),
+			mPages(nullptr),
+			mCurrent(nullptr),
+			mTop(0),
+			mEnd(0),
+			mPageCount(0),
+			mPageIndex(0),
+			mAllocatedBlocks(0),
+			mFreeBlocks(0)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~PoolAllocator() throw() {
+			Page* page = mPages;
+			while(page != nullptr) {
+				Page* const next = page->next;
+				operator delete(page);
+				page = next;
+			}
+		}
+
+		uint32_t getAllocatedBlocks() const throw() {
+			return mAllocatedBlocks;
+		}
+
+		// Inherited from Allocator
+
+		uint32_t SOLAIRE_EXPORT_CALL getAllocatedBytes() const throw() override {
+			return mAllocatedBlocks * SIZE;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL getFreeBytes() const throw() override {
+			// Bytes that can be handed out without acquiring another page from the system
+			const uint64_t idlePages = mCurrent == nullptr ? mPageCount : mPageCount - (mPageIndex + 1);
+			const uint64_t blocks = mFreeBlocks + (mEnd - mTop) / BLOCK_SIZE + idlePages * BLOCKS_PER_PAGE;
+			const uint64_t free = blocks * SIZE;
+			return free > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(free);
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL sizeOf(const void* const aObject) throw() override {
+			return aObject == nullptr ? 0 : SIZE;
+		}
+
+		void* SOLAIRE_EXPORT_CALL allocate(const size_t aBytes) throw() override {
+			if(aBytes > SIZE) return nullptr;
+
+			if(mFreeList != nullptr) {
+				Block* const block = mFreeList;
+				mFreeList = block->next;
+				--mFreeBlocks;
+				++mAllocatedBlocks;
+				return block;
+			}
+
+			if(mTop == mEnd) {
+				if(! nextPage()) return nullptr;
+			}
+
+			void* const block = reinterpret_cast<void*>(mTop);
+			mTop += BLOCK_SIZE;
+			++mAllocatedBlocks;
+			return block;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject) throw() override {
+			if(aObject == nullptr) return false;
+			Block* const block = static_cast<Block*>(const_cast<void*>(aObject));
+			block->next = mFreeList;
+			mFreeList = block;
+			++mFreeBlocks;
+			--mAllocatedBlocks;
+			return true;
+		}
+
+		void* SOLAIRE_EXPORT_CALL allocateAligned(const size_t aBytes, const size_t aAlignment) throw() override {
+			if(aAlignment > BLOCK_ALIGN) return nullptr;
+			return allocate(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject, const size_t) throw() override {
+			return deallocate(aObject);
+		}
+
+		void* SOLAIRE_EXPORT_CALL reallocate(const void* const aObject, const size_t aBytes) throw() override {
+			if(aObject == nullptr) return allocate(aBytes);
+			return aBytes > SIZE ? nullptr : const_cast<void*>(aObject);
+		}
+
+		bool SOLAIRE_EXPORT_CALL allocateBatch(const size_t aBytes, const uint32_t aCount, void** const aOut) throw() override {
+			if(aBytes > SIZE) return false;
+			for(uint32_t i = 0; i < aCount; ++i) {
+				aOut[i] = PoolAllocator::allocate(aBytes);
+				if(aOut[i] == nullptr) {
+					PoolAllocator::deallocateBatch(aOut, i);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocateBatch(void* const* const aObjects, const uint32_t aCount) throw() override {
+			bool result = true;
+			for(uint32_t i = 0; i < aCount; ++i) {
+				if(! PoolAllocator::deallocate(aObjects[i])) result = false;
+			}
+			return result;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocateAll() throw() override {
+			mFreeList = nullptr;
+			mCurrent = nullptr;
+			mPageIndex = 0;
+			mTop = 0;
+			mEnd = 0;
+			mAllocatedBlocks = 0;
+			mFreeBlocks = 0;
+			return true;
+		}
+	};
+
+	/*!
+		\brief A PoolAllocator with blocks large enough to hold a \a T together with the SharedObject that manages it.
+		\detail Each call to Allocator::sharedAllocate or makeShared on the pool takes exactly one block.
+		\tparam T The type of object that will be shared.
+	*/
+	template<class T, const uint32_t BLOCKS_PER_PAGE = 256>
+	using SharedPoolAllocator = PoolAllocator<
+		Implementation::SharedBlock<T>::SIZE,
+		Implementation::SharedBlock<T>::ALIGNMENT,
+		BLOCKS_PER_PAGE
+	>;
+
+}
+#endif
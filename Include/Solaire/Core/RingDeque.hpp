@@ -0,0 +1,334 @@
+#ifndef SOLAIRE_RING_DEQUE_HPP
+#define SOLAIRE_RING_DEQUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file RingDeque.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include "Solaire/Core/DynamicArray.hpp"
+
+namespace Solaire {
+
+    /*!
+        \class RingDeque
+        \brief A Deque that stores its elements in a circular buffer.
+        \detail The capacity is always a power of two so that indices wrap with a mask.
+        pushFront, pushBack, popFront and popBack are all O(1), growth is amortised O(1).
+        \tparam T The type of element to store.
+        \author Adam Smith
+        \date Created : 17th October 2026
+        \date Modified : 17th October 2026
+        \version 1.0
+    */
+    template<class T>
+	class RingDeque : public Deque<T> {
+	public:
+		typedef T Type;
+		typedef const T ConstType;
+		typedef Type& Reference;
+		typedef ConstType& ConstReference;
+		typedef Type* Pointer;
+		typedef ConstType* ConstPointer;
+		typedef RingDeque<T> Self;
+	private:
+	    enum : uint32_t {
+	        MIN_CAPACITY = 8,
+	        MAX_CAPACITY = 1u << 30
+	    };
+
+	    class RingIterator : public Iterator<T> {
+        private:
+            RingDeque<T>& mDeque;
+            int32_t mOffset;
+            bool mReverse;
+        public:
+            RingIterator(RingDeque<T>& aDeque, const int32_t aOffset, const bool aReverse) throw() :
+                mDeque(aDeque),
+                mOffset(aOffset),
+                mReverse(aReverse)
+            {}
+
+            SOLAIRE_EXPORT_CALL ~RingIterator() throw() {
+
+            }
+
+            // Inherited from Iterator
+
+            Iterator<T>& SOLAIRE_EXPORT_CALL increment(const int32_t aCount) throw() override {
+                mOffset += aCount;
+                return *this;
+            }
+
+            Iterator<T>& SOLAIRE_EXPORT_CALL decrement(const int32_t aCount) throw() override {
+                mOffset -= aCount;
+                return *this;
+            }
+
+            SharedAllocation<Iterator<T>> SOLAIRE_EXPORT_CALL copy() const throw() override {
+                return makeSharedAs<Iterator<T>, RingIterator>(mDeque.mAllocator, mDeque, mOffset, mReverse);
+            }
+
+            int32_t SOLAIRE_EXPORT_CALL getOffset() const throw() override {
+                return mOffset;
+            }
+
+            T* SOLAIRE_EXPORT_CALL getPtr() throw() override {
+                return mDeque.getPtr(mReverse ? mDeque.mSize - 1 - mOffset : mOffset);
+            }
+	    };
+	private:
+	    Allocator& mAllocator;
+	    Pointer mData;
+	    uint32_t mHead;
+	    int32_t mSize;
+	    uint32_t mCapacity;
+    private:
+        SOLAIRE_FORCE_INLINE uint32_t wrap(const uint32_t aIndex) const throw() {
+            return aIndex & (mCapacity - 1);
+        }
+
+        bool setCapacity(const uint32_t aCapacity) throw() {
+            const size_t bytes = sizeof(T) * static_cast<size_t>(aCapacity);
+            Pointer const data = static_cast<Pointer>(alignof(T) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+                mAllocator.allocateAligned(bytes, alignof(T)) :
+                mAllocator.allocate(bytes)
+            );
+            if(data == nullptr) return false;
+
+            if(mData) {
+                // Unwrap the elements so that the front is at index 0
+                const uint32_t size = static_cast<uint32_t>(mSize);
+                const uint32_t first = mCapacity - mHead < size ? mCapacity - mHead : size;
+                Implementation::relocate<T>(data, mData + mHead, static_cast<int32_t>(first));
+                Implementation::relocate<T>(data + first, mData, static_cast<int32_t>(size - first));
+                mAllocator.deallocate(mData);
+            }
+
+            mData = data;
+            mHead = 0;
+            mCapacity = aCapacity;
+            return true;
+        }
+
+        void growFor(const int32_t aCount) throw() {
+            const uint32_t required = static_cast<uint32_t>(mSize + aCount);
+            if(required <= mCapacity) return;
+            uint32_t capacity = mCapacity < MIN_CAPACITY ? static_cast<uint32_t>(MIN_CAPACITY) : mCapacity;
+            while(capacity < required && capacity < MAX_CAPACITY) capacity *= 2;
+            // There is no way to report a failed insertion through the Deque interface
+            if(capacity < required || ! setCapacity(capacity)) std::terminate();
+        }
+
+        bool isElement(const T& aValue) const throw() {
+            const ConstPointer ptr = &aValue;
+            return ptr >= mData && ptr < mData + mCapacity;
+        }
+    protected:
+        // Inherited from StaticContainer
+
+        Pointer SOLAIRE_EXPORT_CALL getPtr(int32_t aIndex) throw() override {
+            return mData + wrap(mHead + static_cast<uint32_t>(aIndex));
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL begin_() throw() override {
+            return makeSharedAs<Iterator<Type>, RingIterator>(mAllocator, *this, 0, false);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL end_() throw() override {
+            return makeSharedAs<Iterator<Type>, RingIterator>(mAllocator, *this, mSize, false);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rbegin_() throw() override {
+            return makeSharedAs<Iterator<Type>, RingIterator>(mAllocator, *this, 0, true);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rend_() throw() override {
+            return makeSharedAs<Iterator<Type>, RingIterator>(mAllocator, *this, mSize, true);
+        }
+    public:
+        RingDeque() throw() :
+            mAllocator(getDefaultAllocator()),
+            mData(nullptr),
+            mHead(0),
+            mSize(0),
+            mCapacity(0)
+        {}
+
+        RingDeque(Allocator& aAllocator) throw() :
+            mAllocator(aAllocator),
+            mData(nullptr),
+            mHead(0),
+            mSize(0),
+            mCapacity(0)
+        {}
+
+        RingDeque(const Self& aOther) throw() :
+            mAllocator(aOther.mAllocator),
+            mData(nullptr),
+            mHead(0),
+            mSize(0),
+            mCapacity(0)
+        {
+            operator=(aOther);
+        }
+
+        RingDeque(Self&& aOther) throw() :
+            mAllocator(aOther.mAllocator),
+            mData(aOther.mData),
+            mHead(aOther.mHead),
+            mSize(aOther.mSize),
+            mCapacity(aOther.mCapacity)
+        {
+            aOther.mData = nullptr;
+            aOther.mHead = 0;
+            aOther.mSize = 0;
+            aOther.mCapacity = 0;
+        }
+
+        SOLAIRE_EXPORT_CALL ~RingDeque() throw() {
+            clear();
+            if(mData) mAllocator.deallocate(mData);
+        }
+
+        Self& operator=(const Self& aOther) throw() {
+            if(&aOther == this) return *this;
+            clear();
+            growFor(aOther.mSize);
+            for(int32_t i = 0; i < aOther.mSize; ++i) {
+                new(mData + i) Type(*const_cast<Self&>(aOther).getPtr(i));
+            }
+            mHead = 0;
+            mSize = aOther.mSize;
+            return *this;
+        }
+
+        Self& operator=(Self&& aOther) throw() {
+            if(&mAllocator != &aOther.mAllocator) return operator=(static_cast<const Self&>(aOther));
+            std::swap(mData, aOther.mData);
+            std::swap(mHead, aOther.mHead);
+            std::swap(mSize, aOther.mSize);
+            std::swap(mCapacity, aOther.mCapacity);
+            return *this;
+        }
+
+        /*!
+            \brief Make sure that at least \a aCapacity elements can be stored without reallocating.
+            \return False if the memory could not be allocated.
+        */
+        bool reserve(const int32_t aCapacity) throw() {
+            if(aCapacity <= static_cast<int32_t>(mCapacity)) return true;
+            uint32_t capacity = MIN_CAPACITY;
+            while(capacity < static_cast<uint32_t>(aCapacity)) {
+                if(capacity >= MAX_CAPACITY) return false;
+                capacity *= 2;
+            }
+            return setCapacity(capacity);
+        }
+
+        int32_t capacity() const throw() {
+            return static_cast<int32_t>(mCapacity);
+        }
+
+        // Inherited from StaticContainer
+
+        bool SOLAIRE_EXPORT_CALL isContiguous() const throw() override {
+            // The elements are only contiguous while they don't wrap around the end of the buffer
+            return mHead + static_cast<uint32_t>(mSize) <= mCapacity;
+        }
+
+        int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+            return mSize;
+        }
+
+        Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+            return mAllocator;
+        }
+
+        // Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL pushBack(const Type& aValue) throw() override {
+		    Pointer ptr;
+		    if(static_cast<uint32_t>(mSize) == mCapacity && isElement(aValue)) {
+                // Growing would invalidate aValue
+                Type tmp(aValue);
+                growFor(1);
+                ptr = new(getPtr(mSize)) Type(std::move(tmp));
+		    }else {
+                growFor(1);
+                ptr = new(getPtr(mSize)) Type(aValue);
+		    }
+		    ++mSize;
+		    return *ptr;
+        }
+
+		Type SOLAIRE_EXPORT_CALL popBack() throw() override {
+		    --mSize;
+		    Pointer const ptr = getPtr(mSize);
+		    Type tmp(std::move(*ptr));
+		    ptr->~Type();
+		    return tmp;
+		}
+
+		void SOLAIRE_EXPORT_CALL clear() throw() override {
+		    if(! std::is_trivially_destructible<T>::value) {
+                for(int32_t i = 0; i < mSize; ++i) getPtr(i)->~Type();
+		    }
+            mHead = 0;
+            mSize = 0;
+        }
+
+        // Inherited from Deque
+
+		Type& SOLAIRE_EXPORT_CALL pushFront(const Type& aValue) throw() override {
+		    Pointer ptr;
+		    if(static_cast<uint32_t>(mSize) == mCapacity && isElement(aValue)) {
+                Type tmp(aValue);
+                growFor(1);
+                mHead = wrap(mHead - 1);
+                ptr = new(mData + mHead) Type(std::move(tmp));
+		    }else {
+                growFor(1);
+                mHead = wrap(mHead - 1);
+                ptr = new(mData + mHead) Type(aValue);
+		    }
+		    ++mSize;
+		    return *ptr;
+		}
+
+		Type SOLAIRE_EXPORT_CALL popFront() throw() override {
+		    Pointer const ptr = mData + mHead;
+		    Type tmp(std::move(*ptr));
+		    ptr->~Type();
+		    mHead = wrap(mHead + 1);
+		    --mSize;
+		    return tmp;
+		}
+	};
+}
+
+#endif
@@ -27,23 +27,45 @@
 	Last modified	: Adam Smith
 	\date
 	Created			: 8th December 2015
-	Last Modified	: 11th January 2016
+	Last Modified	: 17th October 2026
 */
 
 #include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include "Solaire/Core/AllocatorI.hpp"
 
+#ifndef SOLAIRE_DISABLE_MULTITHREADING
+    #include <atomic>
+#endif
+
+#ifndef SOLAIRE_SHARED_USER_COUNT
+    #define SOLAIRE_SHARED_USER_COUNT uint32_t
+#endif
+
 namespace Solaire {
 
+    typedef SOLAIRE_SHARED_USER_COUNT SharedUserCount;
+
     namespace Implementation {
         template<class T>
         static void SOLAIRE_EXPORT_CALL SharedObjectDestructor(void* const aObject) throw() {
             static_cast<T*>(aObject)->~T();
         }
+
+        template<class T>
+        struct SharedBlock;
     }
 
 
 
+    template<class T>
+    class SharedAllocation;
+
+    template<class T>
+    class WeakAllocation;
+
     class SharedObject {
     public:
         typedef void (SOLAIRE_EXPORT_CALL *Destructor)(void* const);
@@ -51,28 +73,46 @@ namespace Solaire {
         AllocatorI& mAllocator;
         Destructor mDestructor;
         void* mObject;
-        uint16_t mUsers;
+        #ifdef SOLAIRE_DISABLE_MULTITHREADING
+            SharedUserCount mUsers;
+            SharedUserCount mWeakUsers;
+        #else
+            std::atomic<SharedUserCount> mUsers;
+            std::atomic<SharedUserCount> mWeakUsers;
+        #endif
+        bool mCombined;
+    private:
+        void destroyObject() throw() {
+            if(mObject == nullptr) return;
+            mDestructor(mObject);
+            // Objects created by makeShared live in the same block as their SharedObject
+            if(! mCombined) mAllocator.deallocate(mObject);
+        }
     public:
-        SharedObject(AllocatorI& aAllocator, void* const aObject, Destructor aDestructor) throw() :
+        SharedObject(AllocatorI& aAllocator, void* const aObject, Destructor aDestructor, const bool aCombined = false) throw() :
             mAllocator(aAllocator),
             mDestructor(aDestructor),
             mObject(aObject),
-            mUsers(0)
+            mUsers(0),
+            // The users collectively hold one weak reference, so the SharedObject outlives the object
+            mWeakUsers(1),
+            mCombined(aCombined)
         {}
 
         ~SharedObject() throw() {
-            if(mObject != nullptr) {
-                mDestructor(mObject);
-                mAllocator.deallocate(mObject);
-            }
+            if(getUsers() != 0) destroyObject();
         }
 
         AllocatorI& getAllocator() const throw() {
             return mAllocator;
         }
 
-        uint16_t getUsers() const throw() {
-            return mUsers;
+        SharedUserCount getUsers() const throw() {
+            #ifdef SOLAIRE_DISABLE_MULTITHREADING
+                return mUsers;
+            #else
+                return mUsers.load(std::memory_order_relaxed);
+            #endif
         }
 
         void* getPtr() throw() {
@@ -84,26 +124,104 @@ namespace Solaire {
         }
 
         bool addUser() throw() {
-            ++mUsers;
+            #ifdef SOLAIRE_DISABLE_MULTITHREADING
+                ++mUsers;
+            #else
+                // A new user can only be added by an existing user, so no ordering is required
+                mUsers.fetch_add(1, std::memory_order_relaxed);
+            #endif
             return true;
         }
 
+        bool tryAddUser() throw() {
+            // Only succeeds while the object is still alive, used to upgrade weak references
+            #ifdef SOLAIRE_DISABLE_MULTITHREADING
+                if(mUsers == 0) return false;
+                ++mUsers;
+                return true;
+            #else
+                SharedUserCount users = mUsers.load(std::memory_order_relaxed);
+                while(users != 0) {
+                    if(mUsers.compare_exchange_weak(users, users + 1, std::memory_order_acquire, std::memory_order_relaxed)) return true;
+                }
+                return false;
+            #endif
+        }
+
         bool removeUser() throw() {
-            if(mUsers == 0) return false;
-            if(mUsers == 1 && mObject != nullptr) {
-                mDestructor(mObject);
-                mAllocator.deallocate(mObject);
+            #ifdef SOLAIRE_DISABLE_MULTITHREADING
+                if(mUsers == 0) return false;
+                const SharedUserCount users = mUsers--;
+            #else
+                // Release publishes this user's writes, the acquire fence makes them visible to the thread that destroys the object
+                const SharedUserCount users = mUsers.fetch_sub(1, std::memory_order_release);
+                if(users == 0) {
+                    mUsers.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            #endif
+            if(users == 1) {
+                #ifndef SOLAIRE_DISABLE_MULTITHREADING
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                #endif
+                destroyObject();
+                removeWeakUser();
+            }
+            return true;
+        }
+
+        bool addWeakUser() throw() {
+            #ifdef SOLAIRE_DISABLE_MULTITHREADING
+                ++mWeakUsers;
+            #else
+                mWeakUsers.fetch_add(1, std::memory_order_relaxed);
+            #endif
+            return true;
+        }
+
+        bool removeWeakUser() throw() {
+            #ifdef SOLAIRE_DISABLE_MULTITHREADING
+                if(mWeakUsers == 0) return false;
+                const SharedUserCount users = mWeakUsers--;
+            #else
+                const SharedUserCount users = mWeakUsers.fetch_sub(1, std::memory_order_release);
+                if(users == 0) {
+                    mWeakUsers.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            #endif
+            if(users == 1) {
+                #ifndef SOLAIRE_DISABLE_MULTITHREADING
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                #endif
                 mAllocator.deallocate(this);
             }
             return true;
         }
     };
 
+    namespace Implementation {
+        template<class T>
+        struct SharedBlock {
+            enum : size_t {
+                ALIGNMENT = alignof(T) > alignof(SharedObject) ? alignof(T) : alignof(SharedObject),
+                OFFSET = (sizeof(SharedObject) + alignof(T) - 1) & ~(alignof(T) - 1),
+                SIZE = OFFSET + sizeof(T)
+            };
+        };
+    }
+
 	template<class T>
 	class SharedAllocation {
 	public:
 		template<class T2>
 		friend class SharedAllocation;
+
+		template<class T2>
+		friend class WeakAllocation;
+
+		template<class BASE, class T2, typename ...PARAMS>
+		friend SharedAllocation<BASE> makeSharedAs(AllocatorI&, PARAMS&&...) throw();
 	private:
 		SharedObject* mObject;
     private:
@@ -159,7 +277,7 @@ namespace Solaire {
 			return mObject->getAllocator();
 		}
 
-		uint32_t getUserCount() const throw() {
+		SharedUserCount getUserCount() const throw() {
 			return mObject ? mObject->getUsers() : 0;
 		}
 
@@ -217,6 +335,143 @@ namespace Solaire {
 			return SharedAllocation<const T>(mObject);
 		}
 	};
+
+	/*!
+		\class WeakAllocation
+		\brief A non-owning reference to an object managed by SharedAllocation.
+		\detail The object is destroyed when the last SharedAllocation is released even if WeakAllocations remain,
+		lock can then be used to check whether the object is still alive and take ownership of it.
+		The SharedObject itself is released once the last WeakAllocation is gone.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class WeakAllocation {
+	public:
+		template<class T2>
+		friend class WeakAllocation;
+	private:
+		SharedObject* mObject;
+	public:
+		WeakAllocation() throw() :
+			mObject(nullptr)
+		{}
+
+		WeakAllocation(const SharedAllocation<T>& aOther) throw() :
+			mObject(aOther.mObject)
+		{
+			if(mObject) mObject->addWeakUser();
+		}
+
+		WeakAllocation(const WeakAllocation<T>& aOther) throw() :
+			mObject(aOther.mObject)
+		{
+			if(mObject) mObject->addWeakUser();
+		}
+
+		WeakAllocation(WeakAllocation<T>&& aOther) throw() :
+			mObject(aOther.mObject)
+		{
+			aOther.mObject = nullptr;
+		}
+
+		~WeakAllocation() throw() {
+			if(mObject) mObject->removeWeakUser();
+		}
+
+		WeakAllocation<T>& operator=(const WeakAllocation<T>& aOther) throw() {
+			if(aOther.mObject) aOther.mObject->addWeakUser();
+			if(mObject) mObject->removeWeakUser();
+			mObject = aOther.mObject;
+			return *this;
+		}
+
+		WeakAllocation<T>& operator=(WeakAllocation<T>&& aOther) throw() {
+			swap(aOther);
+			return *this;
+		}
+
+		WeakAllocation<T>& operator=(const SharedAllocation<T>& aOther) throw() {
+			return operator=(WeakAllocation<T>(aOther));
+		}
+
+		void swap(WeakAllocation<T>& aOther) throw() {
+			std::swap(mObject, aOther.mObject);
+		}
+
+		void reset() throw() {
+			if(mObject) mObject->removeWeakUser();
+			mObject = nullptr;
+		}
+
+		SharedUserCount getUserCount() const throw() {
+			return mObject ? mObject->getUsers() : 0;
+		}
+
+		bool expired() const throw() {
+			return getUserCount() == 0;
+		}
+
+		SharedAllocation<T> lock() const throw() {
+			SharedAllocation<T> tmp;
+			if(mObject && mObject->tryAddUser()) tmp.mObject = mObject;
+			return tmp;
+		}
+
+		template<class T2>
+		bool operator==(const WeakAllocation<T2>& aOther) const throw() {
+		    return mObject == aOther.mObject;
+		}
+
+		template<class T2>
+		bool operator!=(const WeakAllocation<T2>& aOther) const throw() {
+		    return mObject != aOther.mObject;
+		}
+	};
+
+	/*!
+		\brief Create a shared object and its SharedObject with a single allocation.
+		\detail The SharedObject is placed at the start of the block and the object after it,
+		both are released with one call to deallocate when the last user is removed.
+		\tparam BASE The type that the object will be shared as, which must have a virtual destructor if it is not \a T.
+		\tparam T The type to allocate.
+		\tparam PARAMS The parameter types to pass to the object's constructor.
+		\param aAllocator The allocator that will own the block.
+		\param aParams The parameters to pass to the object's constructor.
+		\return The shared object, or an empty SharedAllocation if the allocation failed.
+		\see makeShared
+	*/
+	template<class BASE, class T, typename ...PARAMS>
+	SharedAllocation<BASE> makeSharedAs(AllocatorI& aAllocator, PARAMS&&... aParams) throw() {
+		static_assert(std::is_same<BASE, T>::value || std::is_base_of<BASE, T>::value, "SolaireCPP : makeSharedAs requires BASE to be a base of T");
+		static_assert(std::is_same<BASE, T>::value || std::has_virtual_destructor<BASE>::value, "SolaireCPP : makeSharedAs requires BASE to have a virtual destructor");
+
+		typedef Implementation::SharedBlock<T> Block;
+		uint8_t* const block = static_cast<uint8_t*>(static_cast<size_t>(Block::ALIGNMENT) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+			aAllocator.allocateAligned(Block::SIZE, Block::ALIGNMENT) :
+			aAllocator.allocate(Block::SIZE)
+		);
+		if(block == nullptr) return SharedAllocation<BASE>();
+
+		BASE* const object = new(block + Block::OFFSET) T(std::forward<PARAMS>(aParams)...);
+		return SharedAllocation<BASE>(new(block) SharedObject(aAllocator, object, Implementation::SharedObjectDestructor<BASE>, true));
+	}
+
+	/*!
+		\brief Create a shared object and its SharedObject with a single allocation.
+		\tparam T The type to allocate.
+		\tparam PARAMS The parameter types to pass to the object's constructor.
+		\param aAllocator The allocator that will own the block.
+		\param aParams The parameters to pass to the object's constructor.
+		\return The shared object, or an empty SharedAllocation if the allocation failed.
+		\see makeSharedAs
+	*/
+	template<class T, typename ...PARAMS>
+	SharedAllocation<T> makeShared(AllocatorI& aAllocator, PARAMS&&... aParams) throw() {
+		return makeSharedAs<T, T>(aAllocator, std::forward<PARAMS>(aParams)...);
+	}
 }
 
 #endif
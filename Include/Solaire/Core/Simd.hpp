@@ -0,0 +1,438 @@
+#ifndef SOLAIRE_SIMD_HPP
+#define SOLAIRE_SIMD_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file Simd.hpp
+	\brief Vectorised kernels for searching and comparing contiguous runs of arithmetic elements.
+	\detail SSE2 is used whenever the target supports it.
+	AVX2 is selected at run time, so a binary built for plain x86-64 still uses it on processors that have it.
+	Define SOLAIRE_DISABLE_SIMD to use the scalar loops everywhere.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "Solaire/Core/ModuleHeader.hpp"
+
+#if ! defined(SOLAIRE_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define SOLAIRE_SIMD_SSE2
+	#include <emmintrin.h>
+
+	#if defined(_MSC_VER)
+		#define SOLAIRE_SIMD_AVX2
+		#define SOLAIRE_TARGET_AVX2
+		#include <immintrin.h>
+		#include <intrin.h>
+	#elif defined(__GNUC__) || defined(__clang__)
+		#define SOLAIRE_SIMD_AVX2
+		#define SOLAIRE_TARGET_AVX2 __attribute__ ((target("avx2")))
+		#include <immintrin.h>
+	#endif
+#endif
+
+namespace Solaire {
+
+	namespace Implementation {
+
+		/*!
+			\brief Check if the elements of a type can be searched and compared with the vector kernels.
+			\detail Integers, characters, bool and float and double qualify. long double does not because of its padding bytes.
+		*/
+		template<class T>
+		struct IsSimdType : public std::integral_constant<bool,
+			std::is_arithmetic<typename std::remove_cv<T>::type>::value &&
+			! std::is_same<typename std::remove_cv<T>::type, long double>::value &&
+			(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+		> {};
+
+		static inline uint32_t lowestSetBit(const uint32_t aMask) throw() {
+			#ifdef _MSC_VER
+				unsigned long index;
+				_BitScanForward(&index, aMask);
+				return static_cast<uint32_t>(index);
+			#else
+				return static_cast<uint32_t>(__builtin_ctz(aMask));
+			#endif
+		}
+
+		static inline uint32_t highestSetBit(const uint32_t aMask) throw() {
+			#ifdef _MSC_VER
+				unsigned long index;
+				_BitScanReverse(&index, aMask);
+				return static_cast<uint32_t>(index);
+			#else
+				return 31 - static_cast<uint32_t>(__builtin_clz(aMask));
+			#endif
+		}
+
+		#ifdef SOLAIRE_SIMD_AVX2
+			static inline bool detectAvx2() throw() {
+				#ifdef _MSC_VER
+					int info[4];
+					__cpuid(info, 0);
+					if(info[0] < 7) return false;
+					__cpuid(info, 1);
+					// The processor must support AVX and the OS must save the YMM registers
+					if((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) return false;
+					if((_xgetbv(0) & 6) != 6) return false;
+					__cpuidex(info, 7, 0);
+					return (info[1] & (1 << 5)) != 0;
+				#else
+					__builtin_cpu_init();
+					return __builtin_cpu_supports("avx2") != 0;
+				#endif
+			}
+
+			/*!
+				\brief Check if the AVX2 kernels can be used.
+				\detail The processor is only queried on the first call.
+			*/
+			inline bool hasAvx2() throw() {
+				static const bool AVX2 = detectAvx2();
+				return AVX2;
+			}
+		#endif
+
+		#ifdef SOLAIRE_SIMD_SSE2
+			// Lane-wise equality, with every byte of an equal lane set
+
+			template<class T, bool FLOAT = std::is_floating_point<T>::value, size_t SIZE = sizeof(T)>
+			struct Sse2Equal;
+
+			template<class T>
+			struct Sse2Equal<T, false, 1> {
+				static SOLAIRE_FORCE_INLINE __m128i apply(const __m128i a, const __m128i b) throw() { return _mm_cmpeq_epi8(a, b); }
+			};
+
+			template<class T>
+			struct Sse2Equal<T, false, 2> {
+				static SOLAIRE_FORCE_INLINE __m128i apply(const __m128i a, const __m128i b) throw() { return _mm_cmpeq_epi16(a, b); }
+			};
+
+			template<class T>
+			struct Sse2Equal<T, false, 4> {
+				static SOLAIRE_FORCE_INLINE __m128i apply(const __m128i a, const __m128i b) throw() { return _mm_cmpeq_epi32(a, b); }
+			};
+
+			template<class T>
+			struct Sse2Equal<T, false, 8> {
+				// SSE2 has no 64 bit compare, so both 32 bit halves of a lane must match
+				static SOLAIRE_FORCE_INLINE __m128i apply(const __m128i a, const __m128i b) throw() {
+					const __m128i halves = _mm_cmpeq_epi32(a, b);
+					return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+				}
+			};
+
+			template<class T>
+			struct Sse2Equal<T, true, 4> {
+				static SOLAIRE_FORCE_INLINE __m128i apply(const __m128i a, const __m128i b) throw() {
+					return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+				}
+			};
+
+			template<class T>
+			struct Sse2Equal<T, true, 8> {
+				static SOLAIRE_FORCE_INLINE __m128i apply(const __m128i a, const __m128i b) throw() {
+					return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+				}
+			};
+
+			template<class T>
+			static inline __m128i sse2Splat(const T& aValue) throw() {
+				uint8_t bytes[16];
+				for(size_t i = 0; i < 16; i += sizeof(T)) std::memcpy(bytes + i, &aValue, sizeof(T));
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+			}
+
+			template<class T>
+			static inline uint32_t sse2Match(const T* const aData, const __m128i aValue) throw() {
+				const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aData));
+				return static_cast<uint32_t>(_mm_movemask_epi8(Sse2Equal<T>::apply(data, aValue)));
+			}
+
+			template<class T>
+			static inline int32_t sse2SearchForward(const T* const aData, int32_t aBegin, const int32_t aEnd, const T& aValue) throw() {
+				enum : int32_t { WIDTH = 16 / sizeof(T) };
+				const __m128i value = sse2Splat(aValue);
+				for(; aBegin + WIDTH <= aEnd; aBegin += WIDTH) {
+					const uint32_t mask = sse2Match(aData + aBegin, value);
+					if(mask != 0) return aBegin + static_cast<int32_t>(lowestSetBit(mask) / sizeof(T));
+				}
+				for(; aBegin < aEnd; ++aBegin) if(aData[aBegin] == aValue) return aBegin;
+				return aEnd;
+			}
+
+			template<class T>
+			static inline int32_t sse2SearchBackward(const T* const aData, const int32_t aBegin, int32_t aEnd, const T& aValue) throw() {
+				enum : int32_t { WIDTH = 16 / sizeof(T) };
+				const __m128i value = sse2Splat(aValue);
+				int32_t i = aEnd;
+				for(; i - WIDTH >= aBegin; i -= WIDTH) {
+					const uint32_t mask = sse2Match(aData + i - WIDTH, value);
+					if(mask != 0) return i - WIDTH + static_cast<int32_t>(highestSetBit(mask) / sizeof(T));
+				}
+				while(i > aBegin) {
+					--i;
+					if(aData[i] == aValue) return i;
+				}
+				return aEnd;
+			}
+
+			template<class T>
+			static inline int32_t sse2Mismatch(const T* const aFirst, const T* const aSecond, int32_t aBegin, const int32_t aEnd) throw() {
+				enum : int32_t { WIDTH = 16 / sizeof(T) };
+				enum : uint32_t { ALL = 0xFFFF };
+				for(; aBegin + WIDTH <= aEnd; aBegin += WIDTH) {
+					const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aFirst + aBegin));
+					const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSecond + aBegin));
+					const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(Sse2Equal<T>::apply(first, second)));
+					if(mask != ALL) return aBegin + static_cast<int32_t>(lowestSetBit(~mask & ALL) / sizeof(T));
+				}
+				for(; aBegin < aEnd; ++aBegin) if(! (aFirst[aBegin] == aSecond[aBegin])) return aBegin;
+				return aEnd;
+			}
+		#endif
+
+		#ifdef SOLAIRE_SIMD_AVX2
+			template<class T, bool FLOAT = std::is_floating_point<T>::value, size_t SIZE = sizeof(T)>
+			struct Avx2Equal;
+
+			template<class T>
+			struct Avx2Equal<T, false, 1> {
+				static SOLAIRE_TARGET_AVX2 inline __m256i apply(const __m256i a, const __m256i b) throw() { return _mm256_cmpeq_epi8(a, b); }
+			};
+
+			template<class T>
+			struct Avx2Equal<T, false, 2> {
+				static SOLAIRE_TARGET_AVX2 inline __m256i apply(const __m256i a, const __m256i b) throw() { return _mm256_cmpeq_epi16(a, b); }
+			};
+
+			template<class T>
+			struct Avx2Equal<T, false, 4> {
+				static SOLAIRE_TARGET_AVX2 inline __m256i apply(const __m256i a, const __m256i b) throw() { return _mm256_cmpeq_epi32(a, b); }
+			};
+
+			template<class T>
+			struct Avx2Equal<T, false, 8> {
+				static SOLAIRE_TARGET_AVX2 inline __m256i apply(const __m256i a, const __m256i b) throw() { return _mm256_cmpeq_epi64(a, b); }
+			};
+
+			template<class T>
+			struct Avx2Equal<T, true, 4> {
+				static SOLAIRE_TARGET_AVX2 inline __m256i apply(const __m256i a, const __m256i b) throw() {
+					return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+				}
+			};
+
+			template<class T>
+			struct Avx2Equal<T, true, 8> {
+				static SOLAIRE_TARGET_AVX2 inline __m256i apply(const __m256i a, const __m256i b) throw() {
+					return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+				}
+			};
+
+			template<class T>
+			static SOLAIRE_TARGET_AVX2 inline __m256i avx2Splat(const T& aValue) throw() {
+				uint8_t bytes[32];
+				for(size_t i = 0; i < 32; i += sizeof(T)) std::memcpy(bytes + i, &aValue, sizeof(T));
+				return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+			}
+
+			template<class T>
+			static SOLAIRE_TARGET_AVX2 inline uint32_t avx2Match(const T* const aData, const __m256i aValue) throw() {
+				const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aData));
+				return static_cast<uint32_t>(_mm256_movemask_epi8(Avx2Equal<T>::apply(data, aValue)));
+			}
+
+			template<class T>
+			static SOLAIRE_TARGET_AVX2 int32_t avx2SearchForward(const T* const aData, int32_t aBegin, const int32_t aEnd, const T& aValue) throw() {
+				enum : int32_t { WIDTH = 32 / sizeof(T) };
+				const __m256i value = avx2Splat(aValue);
+				// Two vectors per iteration so that the loads of the second overlap the test of the first
+				for(; aBegin + WIDTH * 2 <= aEnd; aBegin += WIDTH * 2) {
+					const uint32_t mask0 = avx2Match(aData + aBegin, value);
+					const uint32_t mask1 = avx2Match(aData + aBegin + WIDTH, value);
+					if((mask0 | mask1) != 0) {
+						if(mask0 != 0) return aBegin + static_cast<int32_t>(lowestSetBit(mask0) / sizeof(T));
+						return aBegin + WIDTH + static_cast<int32_t>(lowestSetBit(mask1) / sizeof(T));
+					}
+				}
+				for(; aBegin + WIDTH <= aEnd; aBegin += WIDTH) {
+					const uint32_t mask = avx2Match(aData + aBegin, value);
+					if(mask != 0) return aBegin + static_cast<int32_t>(lowestSetBit(mask) / sizeof(T));
+				}
+				for(; aBegin < aEnd; ++aBegin) if(aData[aBegin] == aValue) return aBegin;
+				return aEnd;
+			}
+
+			template<class T>
+			static SOLAIRE_TARGET_AVX2 int32_t avx2SearchBackward(const T* const aData, const int32_t aBegin, int32_t aEnd, const T& aValue) throw() {
+				enum : int32_t { WIDTH = 32 / sizeof(T) };
+				const __m256i value = avx2Splat(aValue);
+				int32_t i = aEnd;
+				for(; i - WIDTH >= aBegin; i -= WIDTH) {
+					const uint32_t mask = avx2Match(aData + i - WIDTH, value);
+					if(mask != 0) return i - WIDTH + static_cast<int32_t>(highestSetBit(mask) / sizeof(T));
+				}
+				while(i > aBegin) {
+					--i;
+					if(aData[i] == aValue) return i;
+				}
+				return aEnd;
+			}
+
+			template<class T>
+			static SOLAIRE_TARGET_AVX2 inline uint32_t avx2MatchPair(const T* const aFirst, const T* const aSecond) throw() {
+				const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aFirst));
+				const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aSecond));
+				return static_cast<uint32_t>(_mm256_movemask_epi8(Avx2Equal<T>::apply(first, second)));
+			}
+
+			template<class T>
+			static SOLAIRE_TARGET_AVX2 int32_t avx2Mismatch(const T* const aFirst, const T* const aSecond, int32_t aBegin, const int32_t aEnd) throw() {
+				enum : int32_t { WIDTH = 32 / sizeof(T) };
+				enum : uint32_t { ALL = 0xFFFFFFFF };
+				// Compare two vectors per iteration and only locate the mismatch once one is known to exist
+				for(; aBegin + WIDTH * 2 <= aEnd; aBegin += WIDTH * 2) {
+					const uint32_t mask0 = avx2MatchPair(aFirst + aBegin, aSecond + aBegin);
+					const uint32_t mask1 = avx2MatchPair(aFirst + aBegin + WIDTH, aSecond + aBegin + WIDTH);
+					if((mask0 & mask1) != ALL) {
+						if(mask0 != ALL) return aBegin + static_cast<int32_t>(lowestSetBit(~mask0) / sizeof(T));
+						return aBegin + WIDTH + static_cast<int32_t>(lowestSetBit(~mask1) / sizeof(T));
+					}
+				}
+				for(; aBegin + WIDTH <= aEnd; aBegin += WIDTH) {
+					const uint32_t mask = avx2MatchPair(aFirst + aBegin, aSecond + aBegin);
+					if(mask != ALL) return aBegin + static_cast<int32_t>(lowestSetBit(~mask) / sizeof(T));
+				}
+				for(; aBegin < aEnd; ++aBegin) if(! (aFirst[aBegin] == aSecond[aBegin])) return aBegin;
+				return aEnd;
+			}
+		#endif
+
+		template<class T>
+		static inline int32_t searchForward(const T* const aData, int32_t aBegin, const int32_t aEnd, const T& aValue, std::false_type) throw() {
+			for(; aBegin < aEnd; ++aBegin) if(aData[aBegin] == aValue) return aBegin;
+			return aEnd;
+		}
+
+		template<class T>
+		static inline int32_t searchForward(const T* const aData, int32_t aBegin, const int32_t aEnd, const T& aValue, std::true_type) throw() {
+			#ifdef SOLAIRE_SIMD_AVX2
+				if(aEnd - aBegin >= static_cast<int32_t>(32 / sizeof(T)) && hasAvx2()) return avx2SearchForward(aData, aBegin, aEnd, aValue);
+			#endif
+			#ifdef SOLAIRE_SIMD_SSE2
+				return sse2SearchForward(aData, aBegin, aEnd, aValue);
+			#else
+				return searchForward(aData, aBegin, aEnd, aValue, std::false_type());
+			#endif
+		}
+
+		template<class T>
+		static inline int32_t searchBackward(const T* const aData, const int32_t aBegin, int32_t aEnd, const T& aValue, std::false_type) throw() {
+			for(int32_t i = aEnd - 1; i >= aBegin; --i) if(aData[i] == aValue) return i;
+			return aEnd;
+		}
+
+		template<class T>
+		static inline int32_t searchBackward(const T* const aData, const int32_t aBegin, int32_t aEnd, const T& aValue, std::true_type) throw() {
+			#ifdef SOLAIRE_SIMD_AVX2
+				if(aEnd - aBegin >= static_cast<int32_t>(32 / sizeof(T)) && hasAvx2()) return avx2SearchBackward(aData, aBegin, aEnd, aValue);
+			#endif
+			#ifdef SOLAIRE_SIMD_SSE2
+				return sse2SearchBackward(aData, aBegin, aEnd, aValue);
+			#else
+				return searchBackward(aData, aBegin, aEnd, aValue, std::false_type());
+			#endif
+		}
+
+		/*!
+			\brief Find the first element in [aBegin, aEnd) that equals \a aValue.
+			\detail Arithmetic elements are compared a vector at a time, anything else uses operator==.
+			\return The index of the element, or \a aEnd if there is none.
+		*/
+		template<class T>
+		static inline int32_t searchForward(const T* const aData, const int32_t aBegin, const int32_t aEnd, const T& aValue) throw() {
+			return searchForward(aData, aBegin, aEnd, aValue, IsSimdType<T>());
+		}
+
+		/*!
+			\brief Find the last element in [aBegin, aEnd) that equals \a aValue.
+			\return The index of the element, or \a aEnd if there is none.
+		*/
+		template<class T>
+		static inline int32_t searchBackward(const T* const aData, const int32_t aBegin, const int32_t aEnd, const T& aValue) throw() {
+			return searchBackward(aData, aBegin, aEnd, aValue, IsSimdType<T>());
+		}
+
+		template<class T>
+		static inline int32_t findMismatch(const T* const aFirst, const T* const aSecond, int32_t aBegin, const int32_t aEnd, std::false_type) throw() {
+			for(; aBegin < aEnd; ++aBegin) if(! (aFirst[aBegin] == aSecond[aBegin])) return aBegin;
+			return aEnd;
+		}
+
+		template<class T>
+		static inline int32_t findMismatch(const T* const aFirst, const T* const aSecond, int32_t aBegin, const int32_t aEnd, std::true_type) throw() {
+			#ifdef SOLAIRE_SIMD_AVX2
+				if(aEnd - aBegin >= static_cast<int32_t>(32 / sizeof(T)) && hasAvx2()) return avx2Mismatch(aFirst, aSecond, aBegin, aEnd);
+			#endif
+			#ifdef SOLAIRE_SIMD_SSE2
+				return sse2Mismatch(aFirst, aSecond, aBegin, aEnd);
+			#else
+				return findMismatch(aFirst, aSecond, aBegin, aEnd, std::false_type());
+			#endif
+		}
+
+		/*!
+			\brief Find the first index in [aBegin, aEnd) where two runs of elements are not equal.
+			\detail Elements are compared with operator== semantics, so a NaN never equals anything.
+			\return The index, or \a aEnd if the runs are equal.
+		*/
+		template<class T>
+		static inline int32_t findMismatch(const T* const aFirst, const T* const aSecond, const int32_t aBegin, const int32_t aEnd) throw() {
+			return findMismatch(aFirst, aSecond, aBegin, aEnd, IsSimdType<T>());
+		}
+
+		/*!
+			\brief Lexicographically compare two runs of elements.
+			\detail Elements that are neither less nor greater than each other, such as NaNs, are treated as equivalent.
+			\return A negative value if the first run orders before the second, 0 if they are equivalent or a positive value if it orders after.
+		*/
+		template<class T>
+		static inline int32_t compareRange(const T* const aFirst, const int32_t aFirstSize, const T* const aSecond, const int32_t aSecondSize) throw() {
+			const int32_t length = aFirstSize < aSecondSize ? aFirstSize : aSecondSize;
+			for(int32_t i = findMismatch(aFirst, aSecond, 0, length); i < length; i = findMismatch(aFirst, aSecond, i + 1, length)) {
+				if(aFirst[i] < aSecond[i]) return -1;
+				if(aSecond[i] < aFirst[i]) return 1;
+			}
+			return aFirstSize < aSecondSize ? -1 : aFirstSize > aSecondSize ? 1 : 0;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef SOLAIRE_SMALL_ARRAY_HPP
+#define SOLAIRE_SMALL_ARRAY_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SmallArray.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <type_traits>
+#include "Solaire/Core/DynamicArray.hpp"
+
+namespace Solaire {
+
+    /*!
+        \class SmallArray
+        \brief A Stack that stores up to \a N elements inside the object itself.
+        \detail The Allocator is only used once the inline storage overflows, after which the elements stay on the heap.
+        The elements are contiguous in both cases.
+        \tparam T The type of element to store.
+        \tparam N The number of elements that can be stored without allocating.
+        \author Adam Smith
+        \date Created : 17th October 2026
+        \date Modified : 17th October 2026
+        \version 1.0
+    */
+    template<class T, int32_t N>
+	class SmallArray : public Stack<T> {
+	public:
+		typedef T Type;
+		typedef const T ConstType;
+		typedef Type& Reference;
+		typedef ConstType& ConstReference;
+		typedef Type* Pointer;
+		typedef ConstType* ConstPointer;
+		typedef SmallArray<T, N> Self;
+	private:
+	    static_assert(N > 0, "SolaireCPP : SmallArray must have room for at least one inline element");
+	private:
+	    Allocator& mAllocator;
+	    Pointer mData;
+	    int32_t mSize;
+	    int32_t mCapacity;
+	    typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type mInline;
+    private:
+        Pointer getInline() throw() {
+            return reinterpret_cast<Pointer>(&mInline);
+        }
+
+        void growFor(const int32_t aCount) throw() {
+            const int32_t required = mSize + aCount;
+            if(required <= mCapacity) return;
+            int32_t capacity = mCapacity * 2;
+            if(capacity < required) capacity = required;
+
+            const size_t bytes = sizeof(T) * static_cast<size_t>(capacity);
+            Pointer const data = static_cast<Pointer>(alignof(T) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+                mAllocator.allocateAligned(bytes, alignof(T)) :
+                mAllocator.allocate(bytes)
+            );
+            // There is no way to report a failed insertion through the Stack interface
+            if(data == nullptr) std::terminate();
+
+            Implementation::relocate<T>(data, mData, mSize);
+            if(! isInline()) mAllocator.deallocate(mData);
+            mData = data;
+            mCapacity = capacity;
+        }
+    protected:
+        // Inherited from StaticContainer
+
+        Pointer SOLAIRE_EXPORT_CALL getPtr(int32_t aIndex) throw() override {
+            return mData + aIndex;
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL begin_() throw() override {
+            return makeSharedAs<Iterator<Type>, ContiguousIterator<Type>>(mAllocator, mAllocator, mData, 0);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL end_() throw() override {
+            return makeSharedAs<Iterator<Type>, ContiguousIterator<Type>>(mAllocator, mAllocator, mData, mSize);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rbegin_() throw() override {
+            return makeSharedAs<Iterator<Type>, ReverseContiguousIterator<Type>>(mAllocator, mAllocator, mData + mSize - 1, 0);
+        }
+
+        SharedAllocation<Iterator<Type>> SOLAIRE_EXPORT_CALL rend_() throw() override {
+            return makeSharedAs<Iterator<Type>, ReverseContiguousIterator<Type>>(mAllocator, mAllocator, mData + mSize - 1, mSize);
+        }
+    public:
+        SmallArray() throw() :
+            mAllocator(getDefaultAllocator()),
+            mData(getInline()),
+            mSize(0),
+            mCapacity(N)
+        {}
+
+        SmallArray(Allocator& aAllocator) throw() :
+            mAllocator(aAllocator),
+            mData(getInline()),
+            mSize(0),
+            mCapacity(N)
+        {}
+
+        SmallArray(const Self& aOther) throw() :
+            mAllocator(aOther.mAllocator),
+            mData(getInline()),
+            mSize(0),
+            mCapacity(N)
+        {
+            operator=(aOther);
+        }
+
+        SmallArray(Self&& aOther) throw() :
+            mAllocator(aOther.mAllocator),
+            mData(getInline()),
+            mSize(0),
+            mCapacity(N)
+        {
+            operator=(std::move(aOther));
+        }
+
+        SOLAIRE_EXPORT_CALL ~SmallArray() throw() {
+            clear();
+            if(! isInline()) mAllocator.deallocate(mData);
+        }
+
+        Self& operator=(const Self& aOther) throw() {
+            if(&aOther == this) return *this;
+            clear();
+            growFor(aOther.mSize);
+            for(int32_t i = 0; i < aOther.mSize; ++i) new(mData + i) Type(aOther.mData[i]);
+            mSize = aOther.mSize;
+            return *this;
+        }
+
+        Self& operator=(Self&& aOther) throw() {
+            if(&aOther == this) return *this;
+            if(aOther.isInline() || &mAllocator != &aOther.mAllocator) {
+                clear();
+                growFor(aOther.mSize);
+                Implementation::relocate<T>(mData, aOther.mData, aOther.mSize);
+                mSize = aOther.mSize;
+                aOther.mSize = 0;
+            }else {
+                // Heap storage can be taken without touching the elements
+                clear();
+                if(! isInline()) mAllocator.deallocate(mData);
+                mData = aOther.mData;
+                mSize = aOther.mSize;
+                mCapacity = aOther.mCapacity;
+                aOther.mData = aOther.getInline();
+                aOther.mSize = 0;
+                aOther.mCapacity = N;
+            }
+            return *this;
+        }
+
+        /*!
+            \brief Check if the elements are stored inside the object.
+            \return False if the inline storage has overflowed.
+        */
+        bool isInline() const throw() {
+            return mData == reinterpret_cast<ConstPointer>(&mInline);
+        }
+
+        int32_t capacity() const throw() {
+            return mCapacity;
+        }
+
+        // Inherited from StaticContainer
+
+        bool SOLAIRE_EXPORT_CALL isContiguous() const throw() override {
+            return true;
+        }
+
+        int32_t SOLAIRE_EXPORT_CALL size() const throw() override {
+            return mSize;
+        }
+
+        Allocator& SOLAIRE_EXPORT_CALL getAllocator() const throw() override {
+            return mAllocator;
+        }
+
+        // Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL pushBack(const Type& aValue) throw() override {
+		    if(mSize == mCapacity) {
+                // Growing would invalidate aValue if it is already an element
+                Type tmp(aValue);
+                growFor(1);
+                new(mData + mSize) Type(std::move(tmp));
+		    }else {
+                new(mData + mSize) Type(aValue);
+		    }
+		    return mData[mSize++];
+        }
+
+		Type SOLAIRE_EXPORT_CALL popBack() throw() override {
+		    --mSize;
+		    Type tmp(std::move(mData[mSize]));
+		    mData[mSize].~Type();
+		    return tmp;
+		}
+
+		void SOLAIRE_EXPORT_CALL clear() throw() override {
+            Implementation::destroyRange<T>(mData, mSize);
+            mSize = 0;
+        }
+	};
+}
+
+#endif
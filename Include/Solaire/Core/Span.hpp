@@ -0,0 +1,173 @@
+#ifndef SOLAIRE_SPAN_HPP
+#define SOLAIRE_SPAN_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file Span.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include "Solaire/Core/InlineContainer.hpp"
+
+namespace Solaire {
+
+	template<class T>
+	class ContiguousView;
+
+	/*!
+		\class Span
+		\brief A non-owning reference to a run of elements that are stored in a single block of memory.
+		\detail A span is one pointer and one length and none of its members are virtual, so slicing and searching inline completely.
+		The searches and comparisons are inherited from InlineContainer.
+		It is invalidated by anything that would invalidate a pointer to its elements.
+		A span converts to a ContiguousView, so it can be passed anywhere that a const StaticContainer reference is expected.
+		\tparam T The type of element, which may be const.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see StaticContainer::getSpan
+	*/
+	template<class T>
+	class Span : public InlineContainer<Span<T>, T> {
+	public:
+		typedef T Type;
+		typedef T* Pointer;
+		typedef T& Reference;
+		typedef Span<T> Self;
+	private:
+		T* mData;
+		int32_t mSize;
+	public:
+		SOLAIRE_FORCE_INLINE Span() throw() :
+			mData(nullptr),
+			mSize(0)
+		{}
+
+		SOLAIRE_FORCE_INLINE Span(T* const aData, const int32_t aSize) throw() :
+			mData(aData),
+			mSize(aSize)
+		{}
+
+		template<size_t LENGTH>
+		SOLAIRE_FORCE_INLINE Span(T(&aArray)[LENGTH]) throw() :
+			mData(aArray),
+			mSize(static_cast<int32_t>(LENGTH))
+		{}
+
+		SOLAIRE_FORCE_INLINE operator Span<const T>() const throw() {
+			return Span<const T>(mData, mSize);
+		}
+
+		/*!
+			\brief Wrap the span in a StaticContainer.
+			\detail ContiguousView is defined in Container.hpp.
+		*/
+		SOLAIRE_FORCE_INLINE operator ContiguousView<const T>() const throw() {
+			return ContiguousView<const T>(Span<const T>(mData, mSize));
+		}
+
+		SOLAIRE_FORCE_INLINE T* data() const throw() {
+			return mData;
+		}
+
+		SOLAIRE_FORCE_INLINE int32_t size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE bool isEmpty() const throw() {
+			return mSize == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE bool isContiguous() const throw() {
+			return true;
+		}
+
+		SOLAIRE_FORCE_INLINE T* getPtr(const int32_t aIndex) const throw() {
+			return mData + aIndex;
+		}
+
+		SOLAIRE_FORCE_INLINE T& operator[](const int32_t aIndex) const throw() {
+			return mData[aIndex];
+		}
+
+		SOLAIRE_FORCE_INLINE T* begin() const throw() {
+			return mData;
+		}
+
+		SOLAIRE_FORCE_INLINE T* end() const throw() {
+			return mData + mSize;
+		}
+
+		/*!
+			\brief Get the elements in [aOffset, aOffset + aCount).
+			\detail The range is clamped to the span, so an out of range slice is empty rather than invalid.
+		*/
+		SOLAIRE_FORCE_INLINE Self subspan(int32_t aOffset, int32_t aCount) const throw() {
+			if(aOffset < 0) aOffset = 0;
+			if(aOffset > mSize) aOffset = mSize;
+			if(aCount < 0 || aCount > mSize - aOffset) aCount = mSize - aOffset;
+			return Self(mData + aOffset, aCount);
+		}
+
+		SOLAIRE_FORCE_INLINE Self subspan(const int32_t aOffset) const throw() {
+			return subspan(aOffset, mSize);
+		}
+
+		SOLAIRE_FORCE_INLINE Self first(const int32_t aCount) const throw() {
+			return subspan(0, aCount);
+		}
+
+		SOLAIRE_FORCE_INLINE Self last(const int32_t aCount) const throw() {
+			return subspan(mSize - (aCount < mSize ? aCount : mSize), aCount);
+		}
+
+		SOLAIRE_FORCE_INLINE bool startsWith(const Span<const T> aOther) const throw() {
+			return aOther.size() <= mSize && first(aOther.size()) == aOther;
+		}
+
+		SOLAIRE_FORCE_INLINE bool endsWith(const Span<const T> aOther) const throw() {
+			return aOther.size() <= mSize && last(aOther.size()) == aOther;
+		}
+
+		/*!
+			\brief Find the first occurrence of a run of elements.
+			\return The index that the run starts at, or size() if it does not occur.
+		*/
+		inline int32_t find(const Span<const T> aOther) const throw() {
+			const int32_t length = aOther.size();
+			if(length == 0) return 0;
+			const T* const other = aOther.data();
+			const int32_t end = mSize - length;
+			for(int32_t i = this->findFirstOf(other[0]); i <= end; i = this->findNextOf(i + 1, other[0])) {
+				if(Span<const T>(mData + i, length) == aOther) return i;
+			}
+			return mSize;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,263 @@
+#ifndef SOLAIRE_SPSC_QUEUE_HPP
+#define SOLAIRE_SPSC_QUEUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SpscQueue.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Solaire/Core/Allocator.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		/*!
+			\brief Round a requested queue capacity up to a power of two.
+			\return The capacity, or 0 if \a aCapacity is not positive or is too large.
+		*/
+		static inline uint32_t queueCapacity(const int32_t aCapacity) throw() {
+			if(aCapacity <= 0 || aCapacity > (1 << 30)) return 0;
+			uint32_t capacity = 1;
+			while(capacity < static_cast<uint32_t>(aCapacity)) capacity *= 2;
+			return capacity;
+		}
+	}
+
+	/*!
+		\class SpscQueue
+		\brief A bounded queue for passing elements from exactly one producer thread to exactly one consumer thread.
+		\detail The elements are stored in a ring buffer and neither side ever takes a lock.
+		The head and tail are on separate cache lines and each side keeps a cached copy of the other side's index,
+		so the shared indices are only read when the queue appears to be full or empty.
+		tryPush and tryPushBatch must only be called by the producer, tryPop and tryPopBatch only by the consumer.
+		\tparam T The type of element to store.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+		\see MpmcQueue
+	*/
+	template<class T>
+	class SpscQueue {
+	public:
+		typedef T Type;
+		typedef SpscQueue<T> Self;
+	private:
+		enum : uint32_t {
+			CACHE_LINE_SIZE = 64
+		};
+	private:
+		Allocator& mAllocator;
+		T* mData;
+		uint32_t mMask;
+		uint8_t mPadding0[CACHE_LINE_SIZE];
+		// Written by the producer
+		std::atomic<uint32_t> mTail;
+		uint32_t mCachedHead;
+		uint8_t mPadding1[CACHE_LINE_SIZE];
+		// Written by the consumer
+		std::atomic<uint32_t> mHead;
+		uint32_t mCachedTail;
+		uint8_t mPadding2[CACHE_LINE_SIZE];
+	private:
+		SpscQueue(const Self&) = delete;
+		SpscQueue(Self&&) = delete;
+		Self& operator=(const Self&) = delete;
+		Self& operator=(Self&&) = delete;
+
+		void allocate(const int32_t aCapacity) throw() {
+			const uint32_t capacity = Implementation::queueCapacity(aCapacity);
+			if(capacity == 0) return;
+			const size_t bytes = sizeof(T) * static_cast<size_t>(capacity);
+			mData = static_cast<T*>(alignof(T) > static_cast<size_t>(AllocatorI::DEFAULT_ALIGNMENT) ?
+				mAllocator.allocateAligned(bytes, alignof(T)) :
+				mAllocator.allocate(bytes)
+			);
+			if(mData) mMask = capacity - 1;
+		}
+
+		/*!
+			\return The number of elements that can be pushed, updating the cached head if the queue appears to be full.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t freeSlots(const uint32_t aTail, const uint32_t aWanted) throw() {
+			const uint32_t capacity = mData ? mMask + 1 : 0;
+			uint32_t available = capacity - (aTail - mCachedHead);
+			if(available < aWanted) {
+				mCachedHead = mHead.load(std::memory_order_acquire);
+				available = capacity - (aTail - mCachedHead);
+			}
+			return available;
+		}
+
+		/*!
+			\return The number of elements that can be popped, updating the cached tail if the queue appears to be empty.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t usedSlots(const uint32_t aHead, const uint32_t aWanted) throw() {
+			uint32_t available = mCachedTail - aHead;
+			if(available < aWanted) {
+				mCachedTail = mTail.load(std::memory_order_acquire);
+				available = mCachedTail - aHead;
+			}
+			return available;
+		}
+	public:
+		SpscQueue(const int32_t aCapacity) throw() :
+			mAllocator(getDefaultAllocator()),
+			mData(nullptr),
+			mMask(0),
+			mTail(0),
+			mCachedHead(0),
+			mHead(0),
+			mCachedTail(0)
+		{
+			allocate(aCapacity);
+		}
+
+		SpscQueue(Allocator& aAllocator, const int32_t aCapacity) throw() :
+			mAllocator(aAllocator),
+			mData(nullptr),
+			mMask(0),
+			mTail(0),
+			mCachedHead(0),
+			mHead(0),
+			mCachedTail(0)
+		{
+			allocate(aCapacity);
+		}
+
+		~SpscQueue() throw() {
+			if(mData == nullptr) return;
+			if(! std::is_trivially_destructible<T>::value) {
+				const uint32_t tail = mTail.load(std::memory_order_relaxed);
+				for(uint32_t i = mHead.load(std::memory_order_relaxed); i != tail; ++i) mData[i & mMask].~T();
+			}
+			mAllocator.deallocate(mData);
+		}
+
+		/*!
+			\brief Add an element to the back of the queue.
+			\return False if the queue is full.
+		*/
+		bool tryPush(const T& aValue) throw() {
+			const uint32_t tail = mTail.load(std::memory_order_relaxed);
+			if(freeSlots(tail, 1) == 0) return false;
+			new(mData + (tail & mMask)) T(aValue);
+			mTail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool tryPush(T&& aValue) throw() {
+			const uint32_t tail = mTail.load(std::memory_order_relaxed);
+			if(freeSlots(tail, 1) == 0) return false;
+			new(mData + (tail & mMask)) T(std::move(aValue));
+			mTail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*!
+			\brief Add as many elements as will fit to the back of the queue.
+			\detail The elements become visible to the consumer together.
+			\param aValues The elements to copy.
+			\param aCount The number of elements in \a aValues.
+			\return The number of elements that were pushed.
+		*/
+		int32_t tryPushBatch(const T* const aValues, const int32_t aCount) throw() {
+			if(aCount <= 0) return 0;
+			const uint32_t tail = mTail.load(std::memory_order_relaxed);
+			uint32_t count = freeSlots(tail, static_cast<uint32_t>(aCount));
+			if(count > static_cast<uint32_t>(aCount)) count = static_cast<uint32_t>(aCount);
+			for(uint32_t i = 0; i < count; ++i) new(mData + ((tail + i) & mMask)) T(aValues[i]);
+			mTail.store(tail + count, std::memory_order_release);
+			return static_cast<int32_t>(count);
+		}
+
+		/*!
+			\brief Remove the element at the front of the queue.
+			\param aValue Set to the element if one was removed.
+			\return False if the queue is empty.
+		*/
+		bool tryPop(T& aValue) throw() {
+			const uint32_t head = mHead.load(std::memory_order_relaxed);
+			if(usedSlots(head, 1) == 0) return false;
+			T& value = mData[head & mMask];
+			aValue = std::move(value);
+			value.~T();
+			mHead.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*!
+			\brief Remove up to \a aCount elements from the front of the queue.
+			\param aValues Receives the elements in queue order.
+			\param aCount The maximum number of elements to remove.
+			\return The number of elements that were removed.
+		*/
+		int32_t tryPopBatch(T* const aValues, const int32_t aCount) throw() {
+			if(aCount <= 0) return 0;
+			const uint32_t head = mHead.load(std::memory_order_relaxed);
+			uint32_t count = usedSlots(head, static_cast<uint32_t>(aCount));
+			if(count > static_cast<uint32_t>(aCount)) count = static_cast<uint32_t>(aCount);
+			for(uint32_t i = 0; i < count; ++i) {
+				T& value = mData[(head + i) & mMask];
+				aValues[i] = std::move(value);
+				value.~T();
+			}
+			mHead.store(head + count, std::memory_order_release);
+			return static_cast<int32_t>(count);
+		}
+
+		/*!
+			\return The number of elements in the queue, which may already be out of date if the other thread is active.
+		*/
+		int32_t size() const throw() {
+			// The head is read first so that it can never be ahead of the tail
+			const uint32_t head = mHead.load(std::memory_order_acquire);
+			return static_cast<int32_t>(mTail.load(std::memory_order_acquire) - head);
+		}
+
+		bool isEmpty() const throw() {
+			return size() == 0;
+		}
+
+		/*!
+			\return The maximum number of elements, or 0 if the storage could not be allocated.
+		*/
+		int32_t capacity() const throw() {
+			return mData ? static_cast<int32_t>(mMask + 1) : 0;
+		}
+
+		Allocator& getAllocator() const throw() {
+			return mAllocator;
+		}
+	};
+}
+
+#endif
@@ -75,7 +75,7 @@ namespace Solaire {
             return aExponent == 0 ? 1 : aExponent == 1 ? aValue : aValue * constexprPower(aValue, aExponent - 1);
         }
 
-        static constexpr uint16_t POWERS_OF_10[] = {
+        static constexpr uint64_t POWERS_OF_10[] = {
             constexprPower(10, 0),
             constexprPower(10, 1),
             constexprPower(10, 2),
@@ -39,8 +39,13 @@
 namespace Solaire {
 
 
-    static constexpr char* RunExecutable_FnName = "_RunExecutable@16";
-    static constexpr char* GetTimeMilliseconds_FnName = "_GetTimeMilliseconds@0";
+	#if SOLAIRE_OS == SOLAIRE_WINDOWS
+		static constexpr const char* RunExecutable_FnName = "_RunExecutable@16";
+		static constexpr const char* GetTimeMilliseconds_FnName = "_GetTimeMilliseconds@0";
+	#else
+		static constexpr const char* RunExecutable_FnName = "_RunExecutable";
+		static constexpr const char* GetTimeMilliseconds_FnName = "_GetTimeMilliseconds";
+	#endif
 
 	#ifdef SOLAIRE_EXPORT_IMPORT_LIBRARY
         extern "C" SOLAIRE_EXPORT_API bool SOLAIRE_EXPORT_CALL _RunExecutable(const char* const, Iterator<const char*>&, const Iterator<const char*>&, int* const) throw();
@@ -0,0 +1,596 @@
+#ifndef SOLAIRE_THREAD_CACHING_ALLOCATOR_HPP
+#define SOLAIRE_THREAD_CACHING_ALLOCATOR_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ThreadCachingAllocator.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 17th October 2026
+	Last Modified	: 17th October 2026
+*/
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include "Solaire/Core/Init.hpp"
+#include "Solaire/Core/Allocator.hpp"
+
+namespace Solaire{
+
+	/*!
+		\class ThreadCachingAllocator
+		\brief A thread safe Allocator that serves small blocks from per-thread size class caches.
+		\detail Each thread keeps a free list per size class that it can use without locking. Empty lists
+		are refilled in batches from a central heap, and lists that grow too long return a batch to it.
+		Requests larger than MAX_SMALL_SIZE go straight to operator new.
+		deallocateAll must not be called while other threads are using the allocator.
+		\author Adam Smith
+		\date Created : 17th October 2026
+		\date Modified : 17th October 2026
+		\version 1.0
+	*/
+	class ThreadCachingAllocator : public Allocator {
+	public:
+		enum : uint32_t {
+			ALIGNMENT = 16,
+			HEADER_SIZE = 16,
+			MAX_SMALL_SIZE = 4096,
+			CHUNK_SIZE = 64 * 1024,
+			CLASS_COUNT = 21,
+			LARGE_CLASS = UINT32_MAX,
+			MAX_BATCH_SIZE = 64,
+			MAX_CACHED_ALLOCATORS = 8,
+			CACHE_LINE_SIZE = 64
+		};
+	private:
+		struct Block {
+			Block* next;
+		};
+
+		struct Header {
+			uint32_t size;
+			uint32_t sizeClass;
+			uint32_t reserved[2];
+		};
+
+		// The alignments pad these to HEADER_SIZE and ALIGNMENT bytes, without a zero length array on 64 bit targets
+		struct alignas(HEADER_SIZE) LargeHeader {
+			LargeHeader* prev;
+			LargeHeader* next;
+		};
+
+		struct alignas(ALIGNMENT) Chunk {
+			Chunk* next;
+		};
+
+		struct FreeList {
+			Block* head;
+			uint32_t count;
+		};
+
+		struct CentralList {
+			std::mutex lock;
+			FreeList list;
+			uint8_t padding[CACHE_LINE_SIZE];
+		};
+
+		struct Cache {
+			Cache* prev;
+			Cache* next;
+			ThreadCachingAllocator* owner;
+			uint64_t generation;
+			std::atomic<int64_t> allocatedBytes;
+			FreeList lists[CLASS_COUNT];
+		};
+
+		struct CacheTable {
+			uint64_t ids[MAX_CACHED_ALLOCATORS];
+			Cache* caches[MAX_CACHED_ALLOCATORS];
+			// Set once the thread has destroyed its table, objects destroyed after it must use the central lists
+			bool destroyed;
+
+			CacheTable() throw() :
+				destroyed(false)
+			{
+				for(uint32_t i = 0; i < MAX_CACHED_ALLOCATORS; ++i) {
+					ids[i] = 0;
+					caches[i] = nullptr;
+				}
+			}
+
+			~CacheTable() throw() {
+				SolaireSynchronized(registryLock(),
+					for(uint32_t i = 0; i < MAX_CACHED_ALLOCATORS; ++i) {
+						Cache* const cache = caches[i];
+						if(cache == nullptr) continue;
+						if(cache->owner != nullptr) cache->owner->releaseCache(cache);
+						delete cache;
+						ids[i] = 0;
+						caches[i] = nullptr;
+					}
+					destroyed = true;
+				)
+			}
+		};
+	private:
+		CentralList mCentral[CLASS_COUNT];
+		std::mutex mChunkLock;
+		std::mutex mLargeLock;
+		Chunk* mChunks;
+		LargeHeader* mLargeBlocks;
+		Cache* mCaches;
+		std::atomic<int64_t> mCentralBytes;
+		std::atomic<uint64_t> mGeneration;
+		const uint64_t mID;
+		uint8_t mClassLookup[MAX_SMALL_SIZE / ALIGNMENT + 1];
+	private:
+		ThreadCachingAllocator(const ThreadCachingAllocator&) = delete;
+		ThreadCachingAllocator(ThreadCachingAllocator&&) = delete;
+		ThreadCachingAllocator& operator=(const ThreadCachingAllocator&) = delete;
+		ThreadCachingAllocator& operator=(ThreadCachingAllocator&&) = delete;
+
+		static uint32_t classSize(const uint32_t aClass) throw() {
+			static constexpr uint32_t SIZES[CLASS_COUNT] = {
+				32,		48,		64,		80,		96,		128,	160,
+				192,	256,	320,	384,	512,	640,	768,
+				1024,	1280,	1536,	2048,	2560,	3072,	4096
+			};
+			return SIZES[aClass];
+		}
+
+		static SOLAIRE_FORCE_INLINE uint32_t batchSize(const uint32_t aClass) throw() {
+			const uint32_t batch = (CHUNK_SIZE / 4) / classSize(aClass);
+			return batch > MAX_BATCH_SIZE ? MAX_BATCH_SIZE : batch < 2 ? 2 : batch;
+		}
+
+		static std::mutex& registryLock() throw() {
+			// Shared by every instance so that thread exit can safely run after an allocator has been destroyed
+			static std::mutex LOCK;
+			return LOCK;
+		}
+
+		static CacheTable& cacheTable() throw() {
+			SOLAIRE_THREAD_LOCAL CacheTable TABLE;
+			return TABLE;
+		}
+
+		static uint64_t nextID() throw() {
+			static std::atomic<uint64_t> ID(0);
+			return ++ID;
+		}
+
+		static SOLAIRE_FORCE_INLINE void clearCache(Cache& aCache) throw() {
+			for(uint32_t i = 0; i < CLASS_COUNT; ++i) {
+				aCache.lists[i].head = nullptr;
+				aCache.lists[i].count = 0;
+			}
+		}
+
+		SOLAIRE_FORCE_INLINE Cache* getCache() throw() {
+			CacheTable& table = cacheTable();
+			for(uint32_t i = 0; i < MAX_CACHED_ALLOCATORS; ++i) {
+				if(table.ids[i] == mID) {
+					Cache* const cache = table.caches[i];
+					const uint64_t generation = mGeneration.load(std::memory_order_acquire);
+					if(cache->generation != generation) {
+						clearCache(*cache);
+						cache->generation = generation;
+					}
+					return cache;
+				}
+			}
+			return createCache(table);
+		}
+
+		Cache* createCache(CacheTable& aTable) throw() {
+			// Static objects can still release memory after the main thread's table has been destroyed
+			if(aTable.destroyed) return nullptr;
+			Cache* cache = nullptr;
+			SolaireSynchronized(registryLock(),
+				uint32_t slot = MAX_CACHED_ALLOCATORS;
+				for(uint32_t i = 0; i < MAX_CACHED_ALLOCATORS; ++i) {
+					// Reclaim slots belonging to allocators that have been destroyed
+					if(aTable.caches[i] != nullptr && aTable.caches[i]->owner == nullptr) {
+						delete aTable.caches[i];
+						aTable.caches[i] = nullptr;
+						aTable.ids[i] = 0;
+					}
+					if(aTable.caches[i] == nullptr && slot == MAX_CACHED_ALLOCATORS) slot = i;
+				}
+
+				if(slot != MAX_CACHED_ALLOCATORS) {
+					cache = new(std::nothrow) Cache();
+					if(cache != nullptr) {
+						cache->prev = nullptr;
+						cache->next = mCaches;
+						cache->owner = this;
+						cache->generation = mGeneration.load(std::memory_order_acquire);
+						cache->allocatedBytes = 0;
+						clearCache(*cache);
+						if(mCaches != nullptr) mCaches->prev = cache;
+						mCaches = cache;
+
+						aTable.ids[slot] = mID;
+						aTable.caches[slot] = cache;
+					}
+				}
+			)
+			return cache;
+		}
+
+		void releaseCache(Cache* const aCache) throw() {
+			// Called with the registry lock held
+			if(aCache->generation == mGeneration.load(std::memory_order_acquire)) {
+				for(uint32_t i = 0; i < CLASS_COUNT; ++i) {
+					FreeList& list = aCache->lists[i];
+					if(list.head != nullptr) returnBlocks(i, list, list.count);
+				}
+			}
+			mCentralBytes += aCache->allocatedBytes.load(std::memory_order_relaxed);
+
+			if(aCache->prev != nullptr) aCache->prev->next = aCache->next;
+			else mCaches = aCache->next;
+			if(aCache->next != nullptr) aCache->next->prev = aCache->prev;
+			aCache->owner = nullptr;
+		}
+
+		bool carveChunk(const uint32_t aClass, FreeList& aList) throw() {
+			// Called with the central lock of aClass held
+			Chunk* const chunk = static_cast<Chunk*>(operator new(CHUNK_SIZE, std::nothrow));
+			if(chunk == nullptr) return false;
+			SolaireSynchronized(mChunkLock,
+				chunk->next = mChunks;
+				mChunks = chunk;
+			)
+
+			const uint32_t size = classSize(aClass);
+			const uint32_t count = (CHUNK_SIZE - sizeof(Chunk)) / size;
+			uint8_t* const begin = reinterpret_cast<uint8_t*>(chunk + 1);
+			for(uint32_t i = 0; i < count; ++i) {
+				Block* const block = reinterpret_cast<Block*>(begin + i * size);
+				block->next = aList.head;
+				aList.head = block;
+			}
+			aList.count += count;
+			return true;
+		}
+
+		bool refill(const uint32_t aClass, FreeList& aList) throw() {
+			const uint32_t batch = batchSize(aClass);
+			bool result = true;
+			CentralList& central = mCentral[aClass];
+			SolaireSynchronized(central.lock,
+				if(central.list.head == nullptr) result = carveChunk(aClass, central.list);
+				if(result) {
+					Block* const first = central.list.head;
+					Block* last = first;
+					uint32_t count = 1;
+					while(count < batch && last->next != nullptr) {
+						last = last->next;
+						++count;
+					}
+					central.list.head = last->next;
+					central.list.count -= count;
+					last->next = aList.head;
+					aList.head = first;
+					aList.count += count;
+				}
+			)
+			return result;
+		}
+
+		void returnBlocks(const uint32_t aClass, FreeList& aList, const uint32_t aCount) throw() {
+			Block* const first = aList.head;
+			Block* last = first;
+			for(uint32_t i = 1; i < aCount; ++i) last = last->next;
+			aList.head = last->next;
+			aList.count -= aCount;
+
+			CentralList& central = mCentral[aClass];
+			SolaireSynchronized(central.lock,
+				last->next = central.list.head;
+				central.list.head = first;
+				central.list.count += aCount;
+			)
+		}
+
+		void* allocateLarge(const size_t aBytes, const size_t aAlignment) throw() {
+			const size_t padding = aAlignment > ALIGNMENT ? aAlignment - 1 : 0;
+			uint8_t* const base = static_cast<uint8_t*>(operator new(sizeof(LargeHeader) + HEADER_SIZE + padding + aBytes, std::nothrow));
+			if(base == nullptr) return nullptr;
+
+			const uintptr_t block = (reinterpret_cast<uintptr_t>(base + sizeof(LargeHeader) + HEADER_SIZE) + padding) & ~static_cast<uintptr_t>(padding);
+			Header* const header = reinterpret_cast<Header*>(block) - 1;
+			LargeHeader* const large = reinterpret_cast<LargeHeader*>(header) - 1;
+			header->size = static_cast<uint32_t>(aBytes);
+			header->sizeClass = LARGE_CLASS;
+			header->reserved[0] = static_cast<uint32_t>(reinterpret_cast<uint8_t*>(large) - base);
+
+			large->prev = nullptr;
+			SolaireSynchronized(mLargeLock,
+				large->next = mLargeBlocks;
+				if(mLargeBlocks != nullptr) mLargeBlocks->prev = large;
+				mLargeBlocks = large;
+			)
+
+			mCentralBytes += aBytes;
+			return header + 1;
+		}
+
+		bool deallocateLarge(Header* const aHeader) throw() {
+			LargeHeader* const large = reinterpret_cast<LargeHeader*>(aHeader) - 1;
+			SolaireSynchronized(mLargeLock,
+				if(large->prev != nullptr) large->prev->next = large->next;
+				else mLargeBlocks = large->next;
+				if(large->next != nullptr) large->next->prev = large->prev;
+			)
+			mCentralBytes -= aHeader->size;
+			operator delete(reinterpret_cast<uint8_t*>(large) - aHeader->reserved[0]);
+			return true;
+		}
+
+		void releaseMemory() throw() {
+			SolaireSynchronized(mChunkLock,
+				while(mChunks != nullptr) {
+					Chunk* const next = mChunks->next;
+					operator delete(mChunks);
+					mChunks = next;
+				}
+			)
+
+			SolaireSynchronized(mLargeLock,
+				while(mLargeBlocks != nullptr) {
+					LargeHeader* const next = mLargeBlocks->next;
+					const Header* const header = reinterpret_cast<const Header*>(mLargeBlocks + 1);
+					operator delete(reinterpret_cast<uint8_t*>(mLargeBlocks) - header->reserved[0]);
+					mLargeBlocks = next;
+				}
+			)
+		}
+	public:
+		ThreadCachingAllocator() throw() :
+			mChunks(nullptr),
+			mLargeBlocks(nullptr),
+			mCaches(nullptr),
+			mCentralBytes(0),
+			mGeneration(0),
+			mID(nextID())
+		{
+			for(uint32_t i = 0; i < CLASS_COUNT; ++i) {
+				mCentral[i].list.head = nullptr;
+				mCentral[i].list.count = 0;
+			}
+
+			uint32_t sizeClass = 0;
+			for(uint32_t i = 0; i <= MAX_SMALL_SIZE / ALIGNMENT; ++i) {
+				while(classSize(sizeClass) < i * ALIGNMENT) ++sizeClass;
+				mClassLookup[i] = static_cast<uint8_t>(sizeClass);
+			}
+		}
+
+		SOLAIRE_EXPORT_CALL ~ThreadCachingAllocator() throw() {
+			SolaireSynchronized(registryLock(),
+				for(Cache* i = mCaches; i != nullptr; i = i->next) i->owner = nullptr;
+				mCaches = nullptr;
+			)
+			releaseMemory();
+		}
+
+		// Inherited from Allocator
+
+		uint32_t SOLAIRE_EXPORT_CALL getAllocatedBytes() const throw() override {
+			int64_t bytes = mCentralBytes.load(std::memory_order_relaxed);
+			SolaireSynchronized(registryLock(),
+				for(const Cache* i = mCaches; i != nullptr; i = i->next) bytes += i->allocatedBytes.load(std::memory_order_relaxed);
+			)
+			return bytes < 0 ? 0 : bytes > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(bytes);
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL getFreeBytes() const throw() override {
+			return UINT32_MAX - getAllocatedBytes();
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL sizeOf(const void* const aObject) throw() override {
+			if(aObject == nullptr) return 0;
+			return (static_cast<const Header*>(aObject) - 1)->size;
+		}
+
+		void* SOLAIRE_EXPORT_CALL allocate(const size_t aBytes) throw() override {
+			if(aBytes > UINT32_MAX - CHUNK_SIZE) return nullptr;
+			if(aBytes + HEADER_SIZE > MAX_SMALL_SIZE) return allocateLarge(aBytes, ALIGNMENT);
+
+			const uint32_t sizeClass = mClassLookup[(aBytes + HEADER_SIZE + ALIGNMENT - 1) / ALIGNMENT];
+			Cache* const cache = getCache();
+			Block* block;
+
+			if(cache != nullptr) {
+				FreeList& list = cache->lists[sizeClass];
+				if(list.head == nullptr && ! refill(sizeClass, list)) return nullptr;
+				block = list.head;
+				list.head = block->next;
+				--list.count;
+				cache->allocatedBytes.store(cache->allocatedBytes.load(std::memory_order_relaxed) + aBytes, std::memory_order_relaxed);
+			}else {
+				// This thread is caching too many allocators or is exiting, fall back to the central heap
+				FreeList list = {nullptr, 0};
+				if(! refill(sizeClass, list)) return nullptr;
+				block = list.head;
+				list.head = block->next;
+				--list.count;
+				if(list.head != nullptr) returnBlocks(sizeClass, list, list.count);
+				mCentralBytes += aBytes;
+			}
+
+			Header* const header = reinterpret_cast<Header*>(block);
+			header->size = static_cast<uint32_t>(aBytes);
+			header->sizeClass = sizeClass;
+			return header + 1;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject) throw() override {
+			if(aObject == nullptr) return false;
+			Header* const header = static_cast<Header*>(const_cast<void*>(aObject)) - 1;
+			const uint32_t sizeClass = header->sizeClass;
+			const uint32_t size = header->size;
+			if(sizeClass == LARGE_CLASS) return deallocateLarge(header);
+			if(sizeClass >= CLASS_COUNT) return false;
+
+			Block* const block = reinterpret_cast<Block*>(header);
+			Cache* const cache = getCache();
+
+			if(cache != nullptr) {
+				FreeList& list = cache->lists[sizeClass];
+				block->next = list.head;
+				list.head = block;
+				++list.count;
+				cache->allocatedBytes.store(cache->allocatedBytes.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+
+				const uint32_t batch = batchSize(sizeClass);
+				if(list.count > batch * 2) returnBlocks(sizeClass, list, batch);
+			}else {
+				FreeList list = {block, 1};
+				block->next = nullptr;
+				returnBlocks(sizeClass, list, 1);
+				mCentralBytes -= size;
+			}
+			return true;
+		}
+
+		void* SOLAIRE_EXPORT_CALL allocateAligned(const size_t aBytes, const size_t aAlignment) throw() override {
+			// Size class blocks are only aligned to ALIGNMENT, stricter alignments are served like large blocks
+			if(aAlignment <= ALIGNMENT) return allocate(aBytes);
+			if(aBytes > UINT32_MAX - CHUNK_SIZE || aAlignment > CHUNK_SIZE) return nullptr;
+			return allocateLarge(aBytes, aAlignment);
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocate(const void* const aObject, const size_t) throw() override {
+			return deallocate(aObject);
+		}
+
+		void* SOLAIRE_EXPORT_CALL reallocate(const void* const aObject, const size_t aBytes) throw() override {
+			if(aObject == nullptr) return allocate(aBytes);
+			if(aBytes > UINT32_MAX - CHUNK_SIZE) return nullptr;
+			Header* const header = static_cast<Header*>(const_cast<void*>(aObject)) - 1;
+
+			// Resize in place while the block still fits in its size class
+			const bool fits = header->sizeClass == LARGE_CLASS ?
+				aBytes <= header->size :
+				aBytes + HEADER_SIZE <= classSize(header->sizeClass);
+			if(fits) {
+				mCentralBytes += static_cast<int64_t>(aBytes) - static_cast<int64_t>(header->size);
+				header->size = static_cast<uint32_t>(aBytes);
+				return const_cast<void*>(aObject);
+			}
+
+			void* const tmp = allocate(aBytes);
+			if(tmp == nullptr) return nullptr;
+			std::memcpy(tmp, aObject, header->size);
+			deallocate(aObject);
+			return tmp;
+		}
+
+		bool SOLAIRE_EXPORT_CALL allocateBatch(const size_t aBytes, const uint32_t aCount, void** const aOut) throw() override {
+			Cache* const cache = aBytes + HEADER_SIZE > MAX_SMALL_SIZE ? nullptr : getCache();
+			if(cache == nullptr) return Allocator::allocateBatch(aBytes, aCount, aOut);
+
+			// Look up the cache once and refill the free list in whole batches
+			const uint32_t sizeClass = mClassLookup[(aBytes + HEADER_SIZE + ALIGNMENT - 1) / ALIGNMENT];
+			FreeList& list = cache->lists[sizeClass];
+			for(uint32_t i = 0; i < aCount; ++i) {
+				if(list.head == nullptr && ! refill(sizeClass, list)) {
+					cache->allocatedBytes.store(cache->allocatedBytes.load(std::memory_order_relaxed) + aBytes * i, std::memory_order_relaxed);
+					ThreadCachingAllocator::deallocateBatch(aOut, i);
+					return false;
+				}
+				Header* const header = reinterpret_cast<Header*>(list.head);
+				list.head = list.head->next;
+				--list.count;
+				header->size = static_cast<uint32_t>(aBytes);
+				header->sizeClass = sizeClass;
+				aOut[i] = header + 1;
+			}
+			cache->allocatedBytes.store(cache->allocatedBytes.load(std::memory_order_relaxed) + aBytes * aCount, std::memory_order_relaxed);
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocateBatch(void* const* const aObjects, const uint32_t aCount) throw() override {
+			Cache* const cache = getCache();
+			if(cache == nullptr) return Allocator::deallocateBatch(aObjects, aCount);
+
+			bool result = true;
+			int64_t bytes = 0;
+			for(uint32_t i = 0; i < aCount; ++i) {
+				if(aObjects[i] == nullptr) {
+					result = false;
+					continue;
+				}
+
+				Header* const header = static_cast<Header*>(aObjects[i]) - 1;
+				const uint32_t sizeClass = header->sizeClass;
+				if(sizeClass == LARGE_CLASS) {
+					deallocateLarge(header);
+					continue;
+				}
+				if(sizeClass >= CLASS_COUNT) {
+					result = false;
+					continue;
+				}
+
+				bytes += header->size;
+				FreeList& list = cache->lists[sizeClass];
+				Block* const block = reinterpret_cast<Block*>(header);
+				block->next = list.head;
+				list.head = block;
+				++list.count;
+
+				const uint32_t batch = batchSize(sizeClass);
+				if(list.count > batch * 2) returnBlocks(sizeClass, list, batch);
+			}
+			cache->allocatedBytes.store(cache->allocatedBytes.load(std::memory_order_relaxed) - bytes, std::memory_order_relaxed);
+			return result;
+		}
+
+		bool SOLAIRE_EXPORT_CALL deallocateAll() throw() override {
+			SolaireSynchronized(registryLock(),
+				for(Cache* i = mCaches; i != nullptr; i = i->next) i->allocatedBytes = 0;
+				for(uint32_t i = 0; i < CLASS_COUNT; ++i) {
+					SolaireSynchronized(mCentral[i].lock,
+						mCentral[i].list.head = nullptr;
+						mCentral[i].list.count = 0;
+					)
+				}
+				releaseMemory();
+				mCentralBytes = 0;
+
+				// Thread caches discard their free lists when they see the new generation
+				++mGeneration;
+			)
+			return true;
+		}
+	};
+
+}
+#endif
@@ -16,18 +16,25 @@
 // Email             : solairelibrary@mail.com
 // GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
 
-#include "Solaire\Core\Allocator.hpp"
+#include "Solaire/Core/ThreadCachingAllocator.hpp"
 
 namespace Solaire {
 
-    Allocator* _DEFAULT_ALLOCATOR;
+    static std::atomic<Allocator*> _DEFAULT_ALLOCATOR(nullptr);
+
+    static Allocator& getBuiltinAllocator() throw() {
+        // Never destroyed, objects with static storage may still release memory during shutdown
+        static ThreadCachingAllocator* const ALLOCATOR = new ThreadCachingAllocator();
+        return *ALLOCATOR;
+    }
 
     Allocator& getDefaultAllocator() throw() {
-        return *_DEFAULT_ALLOCATOR;
+        Allocator* const allocator = _DEFAULT_ALLOCATOR.load(std::memory_order_acquire);
+        return allocator ? *allocator : getBuiltinAllocator();
     }
 
     void setDefaultAllocator(Allocator& aAllocator) throw() {
-        _DEFAULT_ALLOCATOR = &aAllocator;
+        _DEFAULT_ALLOCATOR.store(&aAllocator, std::memory_order_release);
     }
 
 }
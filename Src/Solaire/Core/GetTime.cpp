@@ -16,7 +16,7 @@
 // Email             : solairelibrary@mail.com
 // GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
 
-#include "Solaire\Core\System.hpp"
+#include "Solaire/Core/System.hpp"
 #include <chrono>
 
 namespace Solaire {
@@ -16,9 +16,17 @@
 // Email             : solairelibrary@mail.com
 // GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
 
-#include "Solaire\Core\System.hpp"
+#include "Solaire/Core/System.hpp"
+#include <cerrno>
 #include <cstring>
 
+#if SOLAIRE_OS == SOLAIRE_LINUX
+	#include <spawn.h>
+	#include <sys/wait.h>
+
+	extern char** environ;
+#endif
+
 namespace Solaire {
 
 	extern "C" SOLAIRE_EXPORT_API bool SOLAIRE_EXPORT_CALL _RunExecutable(
@@ -68,6 +76,37 @@ namespace Solaire {
 				return false;
 			}
 			return true;
+		#elif SOLAIRE_OS == SOLAIRE_LINUX
+			enum {
+				MAX_ARGUMENTS = 256
+			};
+
+			char* argv[MAX_ARGUMENTS + 2];
+			uint32_t argc = 0;
+
+			argv[argc++] = const_cast<char*>(aPath);
+
+			const int32_t end = aEnd.getOffset();
+			while(aBegin.getOffset() != end) {
+				if(argc > MAX_ARGUMENTS) return false;
+				argv[argc++] = const_cast<char*>(*aBegin.getPtr());
+				aBegin.increment(1);
+			}
+
+			argv[argc] = nullptr;
+
+			pid_t process;
+			if(posix_spawnp(&process, aPath, nullptr, nullptr, argv, environ) != 0) return false;
+
+			int status;
+			while(waitpid(process, &status, 0) < 0) {
+				if(errno != EINTR) return false;
+			}
+
+			if(aReturnCode) {
+				*aReturnCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+			}
+			return true;
 		#else
 			return false;
 		#endif